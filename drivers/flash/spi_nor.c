@@ -294,17 +294,37 @@ static inline int spi_nor_read_id(struct device *dev,
 /**
  * @brief Wait until the flash is ready
  *
+ * Page programs complete within a few milliseconds, the status register
+ * is polled continuously but other threads of the same priority get to
+ * run in between. Erases take tens of milliseconds up to several
+ * seconds, so the calling thread sleeps for poll_ms between two polls
+ * and leaves the CPU to lower priority threads as well.
+ *
  * @param dev The device structure
+ * @param poll_ms Time to sleep between two status polls, 0 to yield only
  * @return 0 on success, negative errno code otherwise
  */
-static int spi_nor_wait_until_ready(struct device *dev)
+static int spi_nor_wait_until_ready(struct device *dev, s32_t poll_ms)
 {
 	int ret;
 	u8_t reg;
 
-	do {
+	while (true) {
 		ret = spi_nor_cmd_read(dev, SPI_NOR_CMD_RDSR, &reg, 1);
-	} while (!ret && (reg & SPI_NOR_WIP_BIT));
+		if (ret || !(reg & SPI_NOR_WIP_BIT)) {
+			break;
+		}
+
+		if (!IS_ENABLED(CONFIG_MULTITHREADING)) {
+			continue;
+		}
+
+		if (poll_ms) {
+			k_sleep(K_MSEC(poll_ms));
+		} else {
+			k_yield();
+		}
+	}
 
 	return ret;
 }
@@ -322,7 +342,7 @@ static int spi_nor_read(struct device *dev, off_t addr, void *dest,
 
 	acquire_device(dev);
 
-	spi_nor_wait_until_ready(dev);
+	spi_nor_wait_until_ready(dev, 0);
 
 	ret = spi_nor_cmd_addr_read(dev, SPI_NOR_CMD_READ, addr, dest, size);
 
@@ -368,7 +388,7 @@ static int spi_nor_write(struct device *dev, off_t addr, const void *src,
 		src = (const u8_t *)src + to_write;
 		addr += to_write;
 
-		spi_nor_wait_until_ready(dev);
+		spi_nor_wait_until_ready(dev, 0);
 	}
 
 out:
@@ -403,7 +423,8 @@ static int spi_nor_erase(struct device *dev, off_t addr, size_t size)
 			NULL, 0);
 			addr += SPI_NOR_BLOCK_SIZE;
 			size -= SPI_NOR_BLOCK_SIZE;
-		} else if ((size >= SPI_NOR_BLOCK32_SIZE)
+		} else if (params->has_be32k
+			   && (size >= SPI_NOR_BLOCK32_SIZE)
 			   && SPI_NOR_IS_BLOCK32_ALIGNED(addr)) {
 			/* 32 KiB block erase */
 			spi_nor_cmd_addr_write(dev, SPI_NOR_CMD_BE_32K, addr,
@@ -425,7 +446,12 @@ static int spi_nor_erase(struct device *dev, off_t addr, size_t size)
 			goto out;
 		}
 
-		spi_nor_wait_until_ready(dev);
+		/* Nothing to poll for before the shortest erase time */
+		if (IS_ENABLED(CONFIG_MULTITHREADING) &&
+		    CONFIG_SPI_NOR_ERASE_POLL_PERIOD) {
+			k_sleep(K_MSEC(CONFIG_SPI_NOR_ERASE_POLL_PERIOD));
+		}
+		spi_nor_wait_until_ready(dev, CONFIG_SPI_NOR_ERASE_POLL_PERIOD);
 	}
 
 out:
@@ -440,7 +466,7 @@ static int spi_nor_write_protection_set(struct device *dev, bool write_protect)
 
 	acquire_device(dev);
 
-	spi_nor_wait_until_ready(dev);
+	spi_nor_wait_until_ready(dev, 0);
 
 	ret = spi_nor_cmd_write(dev, (write_protect) ?
 	      SPI_NOR_CMD_WRDI : SPI_NOR_CMD_WREN);
@@ -87,6 +87,13 @@ extern "C" {
 	data, cfg_info, level, prio, NULL)
 
 
+/* Parallel initialization stops at priority boundaries */
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+#define Z_DEVICE_INIT_PRIORITY(prio) .init_priority = (prio),
+#else
+#define Z_DEVICE_INIT_PRIORITY(prio)
+#endif
+
 /**
  * @def DEVICE_AND_API_INIT
  *
@@ -105,6 +112,7 @@ extern "C" {
 	static struct device_config _CONCAT(__config_, dev_name) __used	  \
 	__attribute__((__section__(".devconfig.init"))) = {		  \
 		.name = drv_name, .init = (init_fn),			  \
+		Z_DEVICE_INIT_PRIORITY(prio)				  \
 		.config_info = (cfg_info)				  \
 	};								  \
 	static Z_DECL_ALIGN(struct device) _CONCAT(__device_, dev_name) __used \
@@ -162,6 +170,7 @@ extern "C" {
 		.name = drv_name, .init = (init_fn),			  \
 		.device_pm_control = (pm_control_fn),			  \
 		.pm  = &_CONCAT(__pm_, dev_name),                         \
+		Z_DEVICE_INIT_PRIORITY(prio)				  \
 		.config_info = (cfg_info)				  \
 	};								  \
 	static Z_DECL_ALIGN(struct device) _CONCAT(__device_, dev_name) __used \
@@ -252,6 +261,7 @@ struct device_pm {
  *
  * @param name name of the device
  * @param init init function for the driver
+ * @param init_priority initialization priority within the init level
  * @param config_info address of driver instance config information
  */
 struct device_config {
@@ -261,6 +271,9 @@ struct device_config {
 	int (*device_pm_control)(struct device *device, u32_t command,
 				 void *context, device_pm_cb cb, void *arg);
 	struct device_pm *pm;
+#endif
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+	u8_t init_priority;
 #endif
 	const void *config_info;
 };
@@ -278,6 +291,59 @@ struct device {
 	void *driver_data;
 };
 
+/**
+ * @brief Parallel initialization entry of a device
+ *
+ * @param dev device initialized in parallel
+ * @param deps names of the devices it depends on
+ * @param num_deps number of entries in deps
+ * @param state initialization state, for kernel use only
+ */
+struct device_init_parallel {
+	struct device *dev;
+	const char * const *deps;
+	u8_t num_deps;
+	atomic_t state;
+};
+
+/**
+ * @def DEVICE_INIT_PARALLEL
+ *
+ * @brief Let a device be initialized in parallel with others
+ *
+ * @details With CONFIG_DEVICE_INIT_PARALLEL, devices of the POST_KERNEL and
+ * APPLICATION levels declared with this macro and sharing an init priority
+ * are initialized concurrently, on the calling thread and on helper threads.
+ * A device only starts once the devices named in its dependency list are
+ * initialized. Devices not declared with this macro, including all SYS_INIT()
+ * entries, are still initialized one at a time in link order, and every
+ * device before them must be done first.
+ *
+ * Dependencies are only looked up among the parallel devices of the same
+ * level and priority, as all other devices it may depend on are initialized
+ * before it anyway. They must not form a cycle.
+ *
+ * Must be used after DEVICE_INIT() or DEVICE_DECLARE() for the device.
+ *
+ * @param dev_name The same as dev_name provided to DEVICE_INIT()
+ * @param ... Names of the devices it depends on, as passed to
+ * device_get_binding(). Can be empty.
+ */
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+#define DEVICE_INIT_PARALLEL(dev_name, ...)				 \
+	static const char * const _CONCAT(__init_deps_, dev_name)[] = {	 \
+		__VA_ARGS__						 \
+	};								 \
+	static Z_STRUCT_SECTION_ITERABLE(device_init_parallel,		 \
+				_CONCAT(__init_parallel_, dev_name)) = { \
+		.dev = DEVICE_GET(dev_name),				 \
+		.deps = _CONCAT(__init_deps_, dev_name),		 \
+		.num_deps = ARRAY_SIZE(_CONCAT(__init_deps_, dev_name)), \
+	}
+#else
+#define DEVICE_INIT_PARALLEL(dev_name, ...)
+#endif
+
 void z_sys_device_do_config_level(s32_t level);
 
 /**
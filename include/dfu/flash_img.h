@@ -10,6 +10,14 @@
 
 #include <storage/flash_map.h>
 
+#ifdef CONFIG_IMG_ASYNC_WRITE
+#include <kernel.h>
+#endif
+
+#ifdef CONFIG_IMG_STREAM_HASH
+#include <tinycrypt/sha256.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -22,6 +30,19 @@ struct flash_img_context {
 #ifdef CONFIG_IMG_ERASE_PROGRESSIVELY
 	off_t off_last;
 #endif
+#ifdef CONFIG_IMG_ASYNC_WRITE
+	u8_t wbuf[CONFIG_IMG_BLOCK_BUF_SIZE];
+	struct k_work work;
+	struct k_sem idle;
+	size_t wbuf_off;
+	u16_t wbuf_bytes;
+	int wr_rc;
+#endif
+#ifdef CONFIG_IMG_STREAM_HASH
+	struct tc_sha256_state_struct sha256;
+	u8_t digest[TC_SHA256_DIGEST_SIZE];
+	bool finalized;
+#endif
 };
 
 /**
@@ -36,6 +57,11 @@ int flash_img_init(struct flash_img_context *ctx);
 /**
  * @brief Read number of bytes of the image written to the flash.
  *
+ * With CONFIG_IMG_ASYNC_WRITE, this counts the blocks handed over to the
+ * background writer, including the one that may still be in progress. They
+ * are only known to be in flash once the final call to
+ * flash_img_buffered_write() with flush set has returned 0.
+ *
  * @param ctx context
  *
  * @return Number of bytes written to the image flash.
@@ -51,6 +77,11 @@ size_t flash_img_bytes_written(struct flash_img_context *ctx);
  * in blocks, the contents of flash from the last byte written up to the next
  * multiple of CONFIG_IMG_BLOCK_BUF_SIZE is padded with 0xff.
  *
+ * With CONFIG_IMG_ASYNC_WRITE, full blocks are programmed in the
+ * background and an error may be reported by a later call. The final call
+ * with flush set waits until everything is in flash. The context must not
+ * be re-initialized or released while a block is still being written.
+ *
  * @param ctx context
  * @param data data to write
  * @param len Number of bytes to write
@@ -62,6 +93,23 @@ size_t flash_img_bytes_written(struct flash_img_context *ctx);
 int flash_img_buffered_write(struct flash_img_context *ctx, u8_t *data,
 		    size_t len, bool flush);
 
+#ifdef CONFIG_IMG_STREAM_HASH
+/**
+ * @brief Get the SHA-256 digest of the image written to the flash.
+ *
+ * The digest covers the data passed to flash_img_buffered_write(), without
+ * the 0xff padding of the last block. It is available once the image has
+ * been flushed successfully, until the context is initialized again.
+ *
+ * @param ctx context
+ * @param digest buffer of TC_SHA256_DIGEST_SIZE bytes for the digest
+ *
+ * @return  0 on success, -EBUSY if the image has not been flushed
+ *          successfully
+ */
+int flash_img_hash_get(struct flash_img_context *ctx, u8_t *digest);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
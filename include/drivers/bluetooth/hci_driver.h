@@ -29,6 +29,12 @@ extern "C" {
 enum {
 	/* The host should never send HCI_Reset */
 	BT_QUIRK_NO_RESET = BIT(0),
+
+	/* The driver has copied outgoing ACL data, including any data in
+	 * net_buf fragments, by the time send() returns. The host may then
+	 * fragment ACL packets in place and pass scattered ACL data.
+	 */
+	BT_QUIRK_ACL_TX_COPY = BIT(1),
 };
 
 /**
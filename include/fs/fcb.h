@@ -121,6 +121,20 @@ struct fcb {
 	/**< Flash area used by the fcb instance, , internal state.
 	 * This can be transfer to FCB user
 	 */
+
+#if defined(CONFIG_FCB_READ_CACHE)
+	const struct flash_sector *f_cache_sector;
+	/**< Sector the read cache holds data of, internal state */
+
+	u32_t f_cache_off;
+	/**< Offset of the cached data within the sector, internal state */
+
+	u16_t f_cache_len;
+	/**< Number of valid bytes in the read cache, internal state */
+
+	u8_t f_cache[CONFIG_FCB_READ_CACHE_SIZE];
+	/**< Read cache for element headers and CRCs, internal state */
+#endif /* CONFIG_FCB_READ_CACHE */
 };
 
 /**
@@ -17,6 +17,18 @@
 extern "C" {
 #endif
 
+/** @brief Block cache statistics of a LittleFS mount */
+struct fs_littlefs_cache_stats {
+	/* Reads served from the cache, counted per cache line. */
+	u32_t hits;
+
+	/* Reads which had to access the flash, counted per cache line. */
+	u32_t misses;
+
+	/* Cache lines loaded ahead of sequential reads. */
+	u32_t read_ahead;
+};
+
 /** @brief Filesystem info structure for LittleFS mount */
 struct fs_littlefs {
 	/* Defaulted in driver, customizable before mount. */
@@ -37,8 +49,29 @@ struct fs_littlefs {
 	struct lfs lfs;
 	const struct flash_area *area;
 	struct k_mutex mutex;
+
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	/* Shared block cache state, reset at mount. */
+	struct fs_littlefs_cache_stats cache_stats;
+	lfs_block_t cache_next_block;
+	lfs_off_t cache_next_off;
+	bool cache_enabled;
+#endif
 };
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+/** @brief Get the block cache statistics of a LittleFS mount.
+ *
+ * The statistics are reset when the file system is mounted.
+ *
+ * @param fs the file system, as stored in the ``.fs_data`` field of
+ * the mount.
+ * @param stats where the statistics are stored.
+ */
+void fs_littlefs_cache_stats_get(struct fs_littlefs *fs,
+				 struct fs_littlefs_cache_stats *stats);
+#endif
+
 /** @brief Define a littlefs configuration with customized size
  * characteristics.
  *
@@ -57,6 +57,15 @@ struct nvs_fs {
 
 	struct k_mutex nvs_lock;
 	struct device *flash_device;
+#if defined(CONFIG_NVS_GC_BACKGROUND)
+	struct k_work gc_work;	/* background garbage collection step */
+	struct k_mutex gc_erase_lock; /* held while erasing in background */
+	u32_t gc_addr;		/* next ate to collect */
+	u32_t gc_stop_addr;	/* last ate of the sector being collected */
+	u16_t gc_sector;	/* sector being collected */
+	u16_t gc_erased;	/* sector erased ahead of time + 1, or 0 */
+	u8_t gc_state;		/* background garbage collection state */
+#endif /* CONFIG_NVS_GC_BACKGROUND */
 };
 
 /**
@@ -1569,6 +1569,27 @@ extern void k_timer_init(struct k_timer *timer,
 __syscall void k_timer_start(struct k_timer *timer,
 			     s32_t duration, s32_t period);
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/**
+ * @brief Set how late a timer may expire.
+ *
+ * This routine allows the expiries of a timer to be delayed by up to
+ * @a slack so that they can be handled in the same wake-up as other
+ * timeouts, instead of waking the system up on their own. The period of a
+ * periodic timer is not affected: late expiries do not accumulate.
+ *
+ * The slack is reset by k_timer_init() and applies from the next time the
+ * kernel programs the system timer, so it is best set before starting the
+ * timer.
+ *
+ * @param timer     Address of timer.
+ * @param slack     Maximum lateness (in milliseconds).
+ *
+ * @return N/A
+ */
+__syscall void k_timer_slack_set(struct k_timer *timer, s32_t slack);
+#endif
+
 /**
  * @brief Stop a timer.
  *
@@ -2220,6 +2241,114 @@ __syscall int k_futex_wake(struct k_futex *futex, bool wake_all);
 /** @} */
 #endif
 
+#ifdef CONFIG_SYSCALL_BATCH
+/**
+ * @defgroup syscall_batch_apis Batched System Call APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/** Number of arguments carried by a batched system call */
+#define K_SYSCALL_BATCH_ARGS 4
+
+/**
+ * @brief Batched system call
+ *
+ * @a id is the K_SYSCALL_* identifier of the call and @a args its
+ * arguments, in the order of the API prototype. @a result receives the
+ * return value of the call once it has been executed.
+ */
+struct k_syscall_batch_entry {
+	u32_t id;
+	int result;
+	uintptr_t args[K_SYSCALL_BATCH_ARGS];
+};
+
+/**
+ * @brief Batched system call ring
+ *
+ * The ring and its entries live in memory the thread can write. The
+ * thread queues calls at @a tail and the kernel executes them in order
+ * when k_syscall_ring_enter() is called, advancing @a head past them.
+ * The result of an executed entry stays valid until its slot is reused.
+ */
+struct k_syscall_ring {
+	struct k_syscall_batch_entry *entries;
+	u32_t size;
+	u32_t head;
+	u32_t tail;
+};
+
+/**
+ * @brief Initialize a batched system call ring.
+ *
+ * @param ring Address of the ring.
+ * @param entries Array of entries backing the ring.
+ * @param size Number of entries, must be a power of two.
+ */
+static inline void k_syscall_ring_init(struct k_syscall_ring *ring,
+				       struct k_syscall_batch_entry *entries,
+				       u32_t size)
+{
+	ring->entries = entries;
+	ring->size = size;
+	ring->head = 0U;
+	ring->tail = 0U;
+}
+
+/**
+ * @brief Queue a system call on a ring.
+ *
+ * Only the system calls listed in kernel/syscall_batch.c can be batched,
+ * and timeout arguments must be K_NO_WAIT so that one call cannot stall
+ * the rest of the batch. Unused arguments are ignored.
+ *
+ * @param ring Address of the ring.
+ * @param id K_SYSCALL_* identifier of the call.
+ *
+ * @retval Address of the entry holding the call.
+ * @retval NULL if the ring is full.
+ */
+static inline struct k_syscall_batch_entry *
+k_syscall_ring_push(struct k_syscall_ring *ring, u32_t id, uintptr_t arg0,
+		    uintptr_t arg1, uintptr_t arg2, uintptr_t arg3)
+{
+	struct k_syscall_batch_entry *entry;
+
+	if (ring->tail - ring->head == ring->size) {
+		return NULL;
+	}
+
+	entry = &ring->entries[ring->tail & (ring->size - 1U)];
+	entry->id = id;
+	entry->args[0] = arg0;
+	entry->args[1] = arg1;
+	entry->args[2] = arg2;
+	entry->args[3] = arg3;
+	ring->tail++;
+
+	return entry;
+}
+
+/**
+ * @brief Execute the system calls queued on a ring.
+ *
+ * The ring and its entries are validated once for the whole batch, each
+ * call then goes through the same object and argument checks as if it
+ * had been invoked directly, minus the cost of entering the kernel.
+ *
+ * @param ring Address of the ring.
+ *
+ * @retval Number of calls executed.
+ * @retval -EINVAL if the ring is malformed or an entry is not a call
+ *	   that can be batched. Calls before the faulty entry have been
+ *	   executed and @a head points at it.
+ */
+__syscall int k_syscall_ring_enter(struct k_syscall_ring *ring);
+
+/** @} */
+#endif /* CONFIG_SYSCALL_BATCH */
+
 struct k_fifo {
 	struct k_queue _queue;
 };
@@ -2733,6 +2862,10 @@ struct k_work {
 	void *_reserved;		/* Used by k_queue implementation. */
 	k_work_handler_t handler;
 	atomic_t flags[1];
+#ifdef CONFIG_WORKQUEUE_POOL
+	u32_t key;			/* Serialization key in pools */
+	u32_t timestamp;		/* Cycle count at submission */
+#endif
 };
 
 struct k_delayed_work {
@@ -2751,6 +2884,28 @@ struct k_work_poll {
 	int poll_result;
 };
 
+#ifdef CONFIG_WORKQUEUE_POOL
+struct k_work_q_pool {
+	/* queue, and thread of the first worker */
+	struct k_work_q work_q;
+	struct k_thread *threads;
+	k_thread_stack_t *stacks;
+	size_t stack_size;
+	size_t stack_stride;
+	/* key of the item each worker is running, 0 if none */
+	u32_t *keys;
+	int nthreads;
+
+	struct k_spinlock lock;
+	/* items held back until the worker running their key is done */
+	sys_slist_t deferred;
+	u32_t deferred_cnt;
+	u32_t processed;
+	u32_t latency_max;
+	u64_t latency_total;
+};
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 extern struct k_work_q k_sys_work_q;
 
 /**
@@ -2823,6 +2978,9 @@ static inline void k_work_submit_to_queue(struct k_work_q *work_q,
 					  struct k_work *work)
 {
 	if (!atomic_test_and_set_bit(work->flags, K_WORK_STATE_PENDING)) {
+#ifdef CONFIG_WORKQUEUE_POOL
+		work->timestamp = k_cycle_get_32();
+#endif
 		k_queue_append(&work_q->queue, work);
 	}
 }
@@ -2930,6 +3088,100 @@ extern void k_work_q_user_start(struct k_work_q *work_q,
 				k_thread_stack_t *stack,
 				size_t stack_size, int prio);
 
+#ifdef CONFIG_WORKQUEUE_POOL
+/**
+ * @brief Statically define a workqueue pool.
+ *
+ * A workqueue pool is a workqueue processed by several threads, so that a
+ * slow work item does not hold back the ones queued behind it. Work items
+ * are submitted to the pool's @a work_q member with the usual workqueue
+ * routines, including the delayed work ones. Items are started in the
+ * order they were submitted but may run concurrently and complete in any
+ * order, unless they share a key set with k_work_key_set().
+ *
+ * The pool must be started with k_work_q_pool_start().
+ *
+ * @param name Name of the workqueue pool.
+ * @param nthreads Number of threads, at least 2.
+ * @param stack_size Stack size of each thread.
+ */
+#define K_WORK_Q_POOL_DEFINE(name, nthreads, stack_size)		\
+	static K_THREAD_STACK_ARRAY_DEFINE(_k_work_q_pool_stack_##name,	\
+					   nthreads, stack_size);	\
+	static struct k_thread						\
+		_k_work_q_pool_thread_##name[(nthreads) - 1];		\
+	static u32_t _k_work_q_pool_key_##name[nthreads];		\
+	struct k_work_q_pool name = {					\
+		.threads = _k_work_q_pool_thread_##name,		\
+		.stacks = _k_work_q_pool_stack_##name[0],		\
+		.stack_size =						\
+		K_THREAD_STACK_SIZEOF(_k_work_q_pool_stack_##name[0]),	\
+		.stack_stride = sizeof(_k_work_q_pool_stack_##name[0]),	\
+		.keys = _k_work_q_pool_key_##name,			\
+		.nthreads = (nthreads),					\
+	}
+
+/**
+ * @brief Workqueue pool statistics.
+ */
+struct k_work_q_pool_stats {
+	/** Work items submitted but not started yet */
+	u32_t depth;
+	/** Work items processed */
+	u32_t processed;
+	/** Average time from submission to start, in microseconds */
+	u32_t latency_avg;
+	/** Longest time from submission to start, in microseconds */
+	u32_t latency_max;
+};
+
+/**
+ * @brief Set the serialization key of a work item.
+ *
+ * Work items sharing a non-zero key never run concurrently in a workqueue
+ * pool, and run in the order they were submitted. A work item with key 0,
+ * the default set by k_work_init(), may run alongside any other item.
+ *
+ * The key must only be changed while the work item is not pending.
+ *
+ * @param work Address of work item.
+ * @param key Serialization key, 0 for none.
+ *
+ * @return N/A
+ */
+static inline void k_work_key_set(struct k_work *work, u32_t key)
+{
+	work->key = key;
+}
+
+/**
+ * @brief Start a workqueue pool.
+ *
+ * This routine starts the threads of a workqueue pool defined with
+ * K_WORK_Q_POOL_DEFINE(). They run forever.
+ *
+ * A work item held back because another item with the same key is running
+ * remains pending, so it can no longer be cancelled.
+ *
+ * @param pool Address of workqueue pool.
+ * @param prio Priority of the pool's threads.
+ *
+ * @return N/A
+ */
+extern void k_work_q_pool_start(struct k_work_q_pool *pool, int prio);
+
+/**
+ * @brief Get the statistics of a workqueue pool.
+ *
+ * @param pool Address of workqueue pool.
+ * @param stats Statistics of the pool, since it was started.
+ *
+ * @return N/A
+ */
+extern void k_work_q_pool_stats_get(struct k_work_q_pool *pool,
+				    struct k_work_q_pool_stats *stats);
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 /**
  * @brief Initialize a delayed work item.
  *
@@ -3085,6 +3337,33 @@ static inline s32_t k_delayed_work_remaining_get(struct k_delayed_work *work)
 	return k_ticks_to_ms_floor64(z_timeout_remaining(&work->timeout));
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/**
+ * @brief Set how late a delayed work item may be submitted.
+ *
+ * This routine allows the submission of a delayed work item to its
+ * workqueue to be delayed by up to @a slack so that it can be handled in
+ * the same wake-up as other timeouts. See k_timer_slack_set().
+ *
+ * @param work     Delayed work item.
+ * @param slack    Maximum lateness (in milliseconds).
+ *
+ * @retval 0 Slack set.
+ * @retval -EINVAL Slack is negative.
+ */
+static inline int k_delayed_work_slack_set(struct k_delayed_work *work,
+					   s32_t slack)
+{
+	if (slack < 0) {
+		return -EINVAL;
+	}
+
+	work->timeout.slack = k_ms_to_ticks_floor32(slack);
+
+	return 0;
+}
+#endif
+
 /**
  * @brief Initialize a triggered work item.
  *
@@ -3301,6 +3580,34 @@ __syscall int k_mutex_lock(struct k_mutex *mutex, s32_t timeout);
  */
 __syscall void k_mutex_unlock(struct k_mutex *mutex);
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+/**
+ * @brief Mutex adaptive spinning statistics.
+ */
+struct k_mutex_spin_stats {
+	/** Locks obtained by spinning */
+	u32_t spin_acquired;
+	/** Spins that ended with the caller pending */
+	u32_t spin_failed;
+	/** Locks for which the caller pended, spinning or not */
+	u32_t blocked;
+};
+
+/**
+ * @brief Get the adaptive spinning statistics of all mutexes.
+ *
+ * With CONFIG_MUTEX_ADAPTIVE_SPIN, a thread locking a mutex owned by a
+ * thread running on another CPU first spins for up to
+ * CONFIG_MUTEX_ADAPTIVE_SPIN_TIME microseconds before pending. This
+ * routine reports how often that spared a context switch.
+ *
+ * @param stats Statistics since boot.
+ *
+ * @return N/A
+ */
+extern void k_mutex_spin_stats_get(struct k_mutex_spin_stats *stats);
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 /**
  * @}
  */
@@ -3629,6 +3936,92 @@ __syscall int k_msgq_put(struct k_msgq *q, void *data, s32_t timeout);
  */
 __syscall int k_msgq_get(struct k_msgq *q, void *data, s32_t timeout);
 
+/**
+ * @brief Send several messages to a message queue.
+ *
+ * This routine sends up to @a count consecutive messages from @a data to
+ * message queue @a q, taking the queue lock and rescheduling only once.
+ * Only as many messages as there is room for are sent; the routine waits
+ * only if the queue is full, and then for the first message only.
+ *
+ * @note Can be called by ISRs, but @a timeout must be set to K_NO_WAIT.
+ *
+ * @param q Address of the message queue.
+ * @param data Pointer to the messages.
+ * @param count Number of messages.
+ * @param timeout Non-negative waiting period to add the first message (in
+ *                milliseconds), or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @retval Number of messages sent.
+ * @retval -ENOMSG Queue purged while waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_msgq_put_n(struct k_msgq *q, void *data, u32_t count,
+			   s32_t timeout);
+
+/**
+ * @brief Receive several messages from a message queue.
+ *
+ * This routine receives up to @a count messages from message queue @a q
+ * into consecutive messages at @a data, taking the queue lock and
+ * rescheduling only once. Only the messages already queued are received;
+ * the routine waits only if the queue is empty, and then for one message.
+ *
+ * @note Can be called by ISRs, but @a timeout must be set to K_NO_WAIT.
+ *
+ * @param q Address of the message queue.
+ * @param data Address of area to hold the received messages.
+ * @param count Maximum number of messages to receive.
+ * @param timeout Non-negative waiting period to receive a message (in
+ *                milliseconds), or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @retval Number of messages received.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_msgq_get_n(struct k_msgq *q, void *data, u32_t count,
+			   s32_t timeout);
+
+/**
+ * @brief Reserve message slots in a message queue.
+ *
+ * This routine gives direct access to up to @a count free and contiguous
+ * message slots of message queue @a q, which the caller fills in place
+ * and then publishes with k_msgq_put_commit(). Fewer slots than requested
+ * are returned when the queue is nearly full or the free space wraps
+ * around the end of the ring buffer.
+ *
+ * Only one reservation may be outstanding and no other thread may send to
+ * the queue until it is committed.
+ *
+ * @note Can be called by ISRs. Not available to user threads since the
+ *       ring buffer is not accessible to them.
+ *
+ * @param q Address of the message queue.
+ * @param data Set to the address of the first reserved slot.
+ * @param count Number of slots requested.
+ *
+ * @return Number of slots reserved, 0 if the queue is full.
+ */
+u32_t k_msgq_put_reserve(struct k_msgq *q, void **data, u32_t count);
+
+/**
+ * @brief Send messages written in reserved slots.
+ *
+ * This routine publishes the first @a count slots obtained from the last
+ * call to k_msgq_put_reserve(), waking up threads waiting to receive.
+ *
+ * @note Can be called by ISRs.
+ *
+ * @param q Address of the message queue.
+ * @param count Number of messages written, at most the number of slots
+ *              reserved.
+ *
+ * @return N/A
+ */
+void k_msgq_put_commit(struct k_msgq *q, u32_t count);
+
 /**
  * @brief Peek/read a message from a message queue.
  *
@@ -32,9 +32,10 @@
  * the number of devices, we go through the below mechanism to allocate the
  * required space.
  */
-#ifdef CONFIG_DEVICE_POWER_MANAGEMENT
 #define DEVICE_COUNT \
 	((__device_init_end - __device_init_start) / _DEVICE_STRUCT_SIZEOF)
+
+#ifdef CONFIG_DEVICE_POWER_MANAGEMENT
 #define DEV_BUSY_SZ	(((DEVICE_COUNT + 31) / 32) * 4)
 #define DEVICE_BUSY_BITFIELD()			\
 		FILL(0x00) ;			\
@@ -45,6 +46,34 @@
 #define DEVICE_BUSY_BITFIELD()
 #endif
 
+/*
+ * Space for the time, in cycles, each device took to initialize.
+ */
+#ifdef CONFIG_BOOT_TIME_MEASUREMENT
+#define DEVICE_INIT_CYCLES()				\
+		FILL(0x00) ;				\
+		. = ALIGN(4);				\
+		__device_init_cycles_start = .;		\
+		. = . + DEVICE_COUNT * 4;		\
+		__device_init_cycles_end = .;
+#else
+#define DEVICE_INIT_CYCLES()
+#endif
+
+/*
+ * Space for the device name index, one u16_t device number per device,
+ * sorted by name at boot.
+ */
+#ifdef CONFIG_DEVICE_NAME_INDEX
+#define DEVICE_NAME_INDEX()				\
+		FILL(0x00) ;				\
+		__device_name_index_start = .;		\
+		. = . + DEVICE_COUNT * 2;		\
+		__device_name_index_end = .;
+#else
+#define DEVICE_NAME_INDEX()
+#endif
+
 /*
  * generate a symbol to mark the start of the device initialization objects for
  * the specified level, then link all of those objects (sorted by priority);
@@ -70,6 +99,8 @@
 		DEVICE_INIT_LEVEL(APPLICATION)	\
 		__device_init_end = .;		\
 		DEVICE_BUSY_BITFIELD()		\
+		DEVICE_INIT_CYCLES()		\
+		DEVICE_NAME_INDEX()		\
 
 
 /* define a section for undefined device initialization levels */
@@ -279,6 +279,23 @@ int settings_load_subtree_direct(
 	settings_load_direct_cb cb,
 	void                   *param);
 
+/**
+ * Load a single serialized item directly into a buffer, without calling any
+ * handler.
+ *
+ * Only the item stored under exactly @p name is read, items below it in the
+ * name hierarchy are not. Backends which can look a name up directly do so,
+ * the others are scanned like @ref settings_load_subtree_direct does.
+ *
+ * @param[in]  name    name of the item to be loaded.
+ * @param[out] buf     buffer the value is read into.
+ * @param[in]  buf_len size of the buffer.
+ *
+ * @return length of the value read on success, -ENOENT if the item is not
+ *         stored, other negative error code on failure.
+ */
+ssize_t settings_load_one(const char *name, void *buf, size_t buf_len);
+
 /**
  * Save currently running serialized items. All serialized items which are
  * different from currently persisted values will be saved.
@@ -312,6 +329,48 @@ int settings_save_one(const char *name, const void *value, size_t val_len);
  */
 int settings_delete(const char *name);
 
+/**
+ * Write the values held by the settings write cache to the storage.
+ *
+ * Values saved with @ref settings_save_one or deleted with
+ * @ref settings_delete may be held in RAM for up to
+ * CONFIG_SETTINGS_WRITE_CACHE_TIMEOUT milliseconds when
+ * CONFIG_SETTINGS_WRITE_CACHE is enabled. Call this function before a
+ * planned reset to make sure they are persisted. It does nothing when the
+ * write cache is disabled.
+ *
+ * This function takes a mutex and writes to the storage, so it must not be
+ * called from an ISR. It cannot be used from a power-fail (brown-out)
+ * interrupt; applications which need the values to survive a power loss
+ * should leave the write cache disabled.
+ *
+ * @return 0 on success, non-zero on failure.
+ */
+int settings_flush(void);
+
+/**
+ * Statistics of the settings write cache.
+ */
+struct settings_write_cache_stats {
+	/** Number of items saved or deleted by the application. */
+	u32_t saves;
+	/** Number of items written to the storage back-end. */
+	u32_t writes;
+	/** Number of writes avoided by replacing a cached value. */
+	u32_t avoided;
+	/** Number of times the cache was flushed. */
+	u32_t flushes;
+};
+
+/**
+ * Get the statistics of the settings write cache.
+ *
+ * Only available when CONFIG_SETTINGS_WRITE_CACHE is enabled.
+ *
+ * @param[out] stats Statistics since boot.
+ */
+void settings_write_cache_stats_get(struct settings_write_cache_stats *stats);
+
 /**
  * Call commit for all settings handler. This should apply all
  * settings which has been set, but not applied yet.
@@ -398,6 +457,21 @@ struct settings_store_itf {
 	 * load callback only on the final entity.
 	 */
 
+	ssize_t (*csi_load_one)(struct settings_store *cs, const char *name,
+				char *buf, size_t buf_len);
+	/**< Loads the value of a single item, looking its name up directly.
+	 *  Optional, backends without it are scanned using csi_load.
+	 *
+	 * Parameters:
+	 *  - cs - Corresponding backend handler node,
+	 *  - name - Key in string format,
+	 *  - buf - Buffer the value is read into,
+	 *  - buf_len - Size of the buffer.
+	 *
+	 * Returns the length read, -ENOENT if the key is not stored, or
+	 * -ENOTSUP if the direct lookup is currently not possible.
+	 */
+
 	int (*csi_save_start)(struct settings_store *cs);
 	/**< Handler called before an export operation.
 	 *
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief public sys_condvar APIs.
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_CONDVAR_H_
+#define ZEPHYR_INCLUDE_SYS_CONDVAR_H_
+
+/*
+ * sys_condvar is a condition variable which may reside in user memory,
+ * used along with a sys_mutex. It is built on a k_futex: signaling a
+ * condition variable nobody waits on does not make any syscall. It
+ * requires CONFIG_USERSPACE.
+ */
+
+#include <kernel.h>
+#include <sys/atomic.h>
+#include <sys/mutex.h>
+#include <zephyr/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * sys_condvar structure
+ */
+struct sys_condvar {
+	/* sequence number, bumped by every signal */
+	struct k_futex futex;
+	atomic_t waiters;
+};
+
+/**
+ * @brief Statically define and initialize a sys_condvar
+ *
+ * Route this to memory domains using K_APP_DMEM().
+ *
+ * @param _name Name of the condition variable.
+ */
+#define SYS_CONDVAR_DEFINE(_name) \
+	struct sys_condvar _name = { \
+		.futex = { 0 }, \
+		.waiters = 0 \
+	}
+
+/**
+ * @brief Initialize a sys_condvar.
+ *
+ * @param condvar Address of the condition variable.
+ */
+static inline void sys_condvar_init(struct sys_condvar *condvar)
+{
+	atomic_set(&condvar->futex.val, 0);
+	atomic_set(&condvar->waiters, 0);
+}
+
+/**
+ * @brief Wait on a sys_condvar.
+ *
+ * This routine atomically releases @a mutex and waits for @a condvar to
+ * be signaled, then locks @a mutex again before returning, whatever the
+ * outcome. The caller must hold @a mutex.
+ *
+ * Wake ups may be spurious: the caller must check the condition it waits
+ * for again.
+ *
+ * @param condvar Address of the condition variable.
+ * @param mutex Address of the mutex protecting the condition.
+ * @param timeout Waiting period (in milliseconds), or one of the special
+ *                values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Woken up.
+ * @retval -ETIMEDOUT Waiting period timed out.
+ * @retval -EINVAL Parameter address not recognized.
+ * @retval -EACCES Caller does not have enough access.
+ */
+int sys_condvar_wait(struct sys_condvar *condvar, struct sys_mutex *mutex,
+		     s32_t timeout);
+
+/**
+ * @brief Wake up one thread waiting on a sys_condvar.
+ *
+ * @param condvar Address of the condition variable.
+ *
+ * @retval 0 Condition variable signaled.
+ * @retval -EINVAL Parameter address not recognized.
+ * @retval -EACCES Caller does not have enough access.
+ */
+int sys_condvar_signal(struct sys_condvar *condvar);
+
+/**
+ * @brief Wake up all threads waiting on a sys_condvar.
+ *
+ * @param condvar Address of the condition variable.
+ *
+ * @retval 0 Condition variable signaled.
+ * @retval -EINVAL Parameter address not recognized.
+ * @retval -EACCES Caller does not have enough access.
+ */
+int sys_condvar_broadcast(struct sys_condvar *condvar);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -11,23 +11,30 @@
  * sys_mutex behaves almost exactly like k_mutex, with the added advantage
  * that a sys_mutex instance can reside in user memory.
  *
- * Further enhancements will support locking/unlocking uncontended sys_mutexes
- * with simple atomic ops instead of syscalls, similar to Linux's
- * FUTEX_LOCK_PI and FUTEX_UNLOCK_PI
+ * With CONFIG_SYS_MUTEX_FUTEX, uncontended sys_mutexes are locked and
+ * unlocked with atomic ops instead of syscalls, and the kernel is only
+ * entered to wait for or wake up a contender, like a futex. Such mutexes
+ * can't be locked recursively, don't raise the priority of their owner and
+ * don't check that they are unlocked by their owner, as the owner is not
+ * known without a syscall.
  */
 
 #ifdef CONFIG_USERSPACE
+#include <errno.h>
 #include <sys/atomic.h>
 #include <zephyr/types.h>
 
 struct sys_mutex {
-	/* Currently unused, but will be used to store state for fast mutexes
-	 * that can be locked/unlocked with atomic ops if there is no
-	 * contention
+	/* With CONFIG_SYS_MUTEX_FUTEX, one of the SYS_MUTEX_* states below,
+	 * unused otherwise.
 	 */
 	atomic_t val;
 };
 
+#define SYS_MUTEX_UNLOCKED	0
+#define SYS_MUTEX_LOCKED	1
+#define SYS_MUTEX_CONTENDED	2
+
 #define SYS_MUTEX_DEFINE(name) \
 	struct sys_mutex name
 
@@ -47,17 +54,27 @@ struct sys_mutex {
  */
 static inline void sys_mutex_init(struct sys_mutex *mutex)
 {
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+	atomic_set(&mutex->val, SYS_MUTEX_UNLOCKED);
+#else
 	ARG_UNUSED(mutex);
+#endif
 
-	/* Nothing to do, kernel-side data structures are initialized at
-	 * boot
-	 */
+	/* Kernel-side data structures are initialized at boot */
 }
 
 __syscall int z_sys_mutex_kernel_lock(struct sys_mutex *mutex, s32_t timeout);
 
 __syscall int z_sys_mutex_kernel_unlock(struct sys_mutex *mutex);
 
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+__syscall int z_sys_mutex_kernel_wait(struct sys_mutex *mutex, s32_t timeout);
+
+__syscall int z_sys_mutex_kernel_wake(struct sys_mutex *mutex);
+
+int z_sys_mutex_lock_contended(struct sys_mutex *mutex, s32_t timeout);
+#endif
+
 /**
  * @brief Lock a mutex.
  *
@@ -68,6 +85,10 @@ __syscall int z_sys_mutex_kernel_unlock(struct sys_mutex *mutex);
  * A thread is permitted to lock a mutex it has already locked. The operation
  * completes immediately and the lock count is increased by 1.
  *
+ * With CONFIG_SYS_MUTEX_FUTEX, the mutex has no owner or lock count: locking
+ * it again from the owning thread deadlocks, and the owner does not inherit
+ * the priority of the waiters.
+ *
  * @param mutex Address of the mutex, which may reside in user memory
  * @param timeout Waiting period to lock the mutex (in milliseconds),
  *                or one of the special values K_NO_WAIT and K_FOREVER.
@@ -80,8 +101,15 @@ __syscall int z_sys_mutex_kernel_unlock(struct sys_mutex *mutex);
  */
 static inline int sys_mutex_lock(struct sys_mutex *mutex, s32_t timeout)
 {
-	/* For now, make the syscall unconditionally */
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+	if (atomic_cas(&mutex->val, SYS_MUTEX_UNLOCKED, SYS_MUTEX_LOCKED)) {
+		return 0;
+	}
+
+	return z_sys_mutex_lock_contended(mutex, timeout);
+#else
 	return z_sys_mutex_kernel_lock(mutex, timeout);
+#endif
 }
 
 /**
@@ -94,6 +122,9 @@ static inline int sys_mutex_lock(struct sys_mutex *mutex, s32_t timeout)
  * the calling thread as many times as it was previously locked by that
  * thread.
  *
+ * With CONFIG_SYS_MUTEX_FUTEX, the caller is not checked to own the mutex,
+ * so -EPERM is never returned.
+ *
  * @param mutex Address of the mutex, which may reside in user memory
  * @retval -EACCESS Caller has no access to provided mutex address
  * @retval -EINVAL Provided mutex not recognized by the kernel or mutex wasn't
@@ -102,8 +133,18 @@ static inline int sys_mutex_lock(struct sys_mutex *mutex, s32_t timeout)
  */
 static inline int sys_mutex_unlock(struct sys_mutex *mutex)
 {
-	/* For now, make the syscall unconditionally */
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+	switch (atomic_set(&mutex->val, SYS_MUTEX_UNLOCKED)) {
+	case SYS_MUTEX_LOCKED:
+		return 0;
+	case SYS_MUTEX_CONTENDED:
+		return z_sys_mutex_kernel_wake(mutex);
+	default:
+		return -EINVAL;
+	}
+#else
 	return z_sys_mutex_kernel_unlock(mutex);
+#endif
 }
 
 #include <syscalls/mutex.h>
@@ -413,6 +413,217 @@ int ring_buf_get_finish(struct ring_buf *buf, u32_t size);
  */
 u32_t ring_buf_get(struct ring_buf *buf, u8_t *data, u32_t size);
 
+/**
+ * @brief A structure to represent a lock-free byte ring buffer
+ *
+ * Unlike @ref ring_buf, a lock-free ring buffer can be written and read
+ * concurrently, from threads or ISRs and on SMP, without any locking. The
+ * head and tail are free-running byte counters published with atomic
+ * operations, which also order the accesses to the data they cover.
+ *
+ * There is a single consumer. Producers use either the single-producer
+ * calls (ring_buf_lf_put_*) or, when several of them may write at the same
+ * time, the multi-producer calls (ring_buf_lf_mp_put_*). Both kinds must
+ * not be mixed on the same ring buffer.
+ */
+struct ring_buf_lf {
+	atomic_t head;     /**< Bytes released by the consumer */
+	atomic_t tail;     /**< Bytes published to the consumer */
+	atomic_t tmp_tail; /**< Bytes claimed by producers */
+	atomic_t writers;  /**< Multi-producer claims not finished yet */
+	u32_t tmp_head;    /**< Bytes claimed by the consumer */
+	u32_t mask;        /**< Size of buf minus one */
+	u8_t *buf;
+};
+
+/**
+ * @brief Statically define and initialize a lock-free ring buffer.
+ *
+ * The lock-free ring buffer can be accessed outside the module where it
+ * is defined using:
+ *
+ * @code extern struct ring_buf_lf <name>; @endcode
+ *
+ * @param name Name of the ring buffer.
+ * @param pow Ring buffer size exponent, the size is 2^pow bytes.
+ */
+#define RING_BUF_LF_DECLARE_POW2(name, pow) \
+	static u8_t _ring_buffer_data_##name[BIT(pow)]; \
+	struct ring_buf_lf name = { \
+		.mask = (BIT(pow)) - 1, \
+		.buf = _ring_buffer_data_##name \
+	}
+
+/**
+ * @brief Initialize a lock-free ring buffer.
+ *
+ * @param buf Address of ring buffer.
+ * @param size Ring buffer size (in bytes), must be a power of 2.
+ * @param data Ring buffer data area.
+ */
+static inline void ring_buf_lf_init(struct ring_buf_lf *buf, u32_t size,
+				    u8_t *data)
+{
+	__ASSERT(is_power_of_two(size), "size must be a power of 2");
+
+	memset(buf, 0, sizeof(struct ring_buf_lf));
+	buf->mask = size - 1;
+	buf->buf = data;
+}
+
+/**
+ * @brief Determine if a lock-free ring buffer is empty.
+ *
+ * @param buf Address of ring buffer.
+ *
+ * @return 1 if the ring buffer is empty, or 0 if not.
+ */
+static inline int ring_buf_lf_is_empty(struct ring_buf_lf *buf)
+{
+	return atomic_get(&buf->head) == atomic_get(&buf->tail);
+}
+
+/**
+ * @brief Determine free space in a lock-free ring buffer.
+ *
+ * The result is only a snapshot when other contexts use the ring buffer.
+ *
+ * @param buf Address of ring buffer.
+ *
+ * @return Ring buffer free space (in bytes).
+ */
+static inline u32_t ring_buf_lf_space_get(struct ring_buf_lf *buf)
+{
+	return buf->mask + 1 - ((u32_t)atomic_get(&buf->tmp_tail) -
+				(u32_t)atomic_get(&buf->head));
+}
+
+/**
+ * @brief Allocate buffer for writing data to a lock-free ring buffer.
+ *
+ * Single-producer version of @ref ring_buf_put_claim. The claimed area can
+ * be smaller than requested if there is not enough free space or the
+ * buffer wraps.
+ *
+ * @param[in]  buf  Address of ring buffer.
+ * @param[out] data Set to a location within the ring buffer.
+ * @param[in]  size Requested allocation size (in bytes).
+ *
+ * @return Size of allocated buffer.
+ */
+u32_t ring_buf_lf_put_claim(struct ring_buf_lf *buf, u8_t **data, u32_t size);
+
+/**
+ * @brief Publish bytes written to claimed buffers.
+ *
+ * Single-producer version of @ref ring_buf_put_finish. Claimed bytes past
+ * @a size are released.
+ *
+ * @param buf  Address of ring buffer.
+ * @param size Number of valid bytes in the claimed buffers.
+ *
+ * @retval 0 Successful operation.
+ * @retval -EINVAL Provided @a size exceeds the claimed size.
+ */
+int ring_buf_lf_put_finish(struct ring_buf_lf *buf, u32_t size);
+
+/**
+ * @brief Write (copy) data to a lock-free ring buffer.
+ *
+ * Single-producer version of @ref ring_buf_put.
+ *
+ * @param buf Address of ring buffer.
+ * @param data Address of data.
+ * @param size Data size (in bytes).
+ *
+ * @retval Number of bytes written.
+ */
+u32_t ring_buf_lf_put(struct ring_buf_lf *buf, const u8_t *data, u32_t size);
+
+/**
+ * @brief Allocate buffer for writing data, with several producers.
+ *
+ * The whole claimed area must be written and published with
+ * ring_buf_lf_mp_put_finish(). Data published by a producer becomes
+ * visible to the consumer once no other producer is between a claim and
+ * its finish, so claims should be kept short.
+ *
+ * @param[in]  buf  Address of ring buffer.
+ * @param[out] data Set to a location within the ring buffer.
+ * @param[in]  size Requested allocation size (in bytes).
+ *
+ * @return Size of allocated buffer, which can be smaller than requested if
+ *	   there is not enough free space or the buffer wraps. Nothing is to
+ *	   be finished if it is 0.
+ */
+u32_t ring_buf_lf_mp_put_claim(struct ring_buf_lf *buf, u8_t **data,
+			       u32_t size);
+
+/**
+ * @brief Publish a buffer claimed with ring_buf_lf_mp_put_claim().
+ *
+ * @param buf Address of ring buffer.
+ */
+void ring_buf_lf_mp_put_finish(struct ring_buf_lf *buf);
+
+/**
+ * @brief Write (copy) data to a lock-free ring buffer, with several
+ * producers.
+ *
+ * The data is written as a whole or not at all, so the data of concurrent
+ * producers is never interleaved.
+ *
+ * @param buf Address of ring buffer.
+ * @param data Address of data.
+ * @param size Data size (in bytes).
+ *
+ * @retval Number of bytes written, either @a size or 0.
+ */
+u32_t ring_buf_lf_mp_put(struct ring_buf_lf *buf, const u8_t *data,
+			 u32_t size);
+
+/**
+ * @brief Get address of valid data in a lock-free ring buffer.
+ *
+ * Consumer version of @ref ring_buf_get_claim.
+ *
+ * @param[in]  buf  Address of ring buffer.
+ * @param[out] data Set to a location within the ring buffer.
+ * @param[in]  size Requested size (in bytes).
+ *
+ * @return Number of valid bytes in the provided buffer which can be smaller
+ *	   than requested if there is not enough data or the buffer wraps.
+ */
+u32_t ring_buf_lf_get_claim(struct ring_buf_lf *buf, u8_t **data,
+			    u32_t size);
+
+/**
+ * @brief Release bytes read from claimed buffers.
+ *
+ * Consumer version of @ref ring_buf_get_finish. Claimed bytes past
+ * @a size stay in the ring buffer.
+ *
+ * @param buf  Address of ring buffer.
+ * @param size Number of bytes that can be freed.
+ *
+ * @retval 0 Successful operation.
+ * @retval -EINVAL Provided @a size exceeds the claimed size.
+ */
+int ring_buf_lf_get_finish(struct ring_buf_lf *buf, u32_t size);
+
+/**
+ * @brief Read data from a lock-free ring buffer.
+ *
+ * Consumer version of @ref ring_buf_get.
+ *
+ * @param buf  Address of ring buffer.
+ * @param data Address of the output buffer.
+ * @param size Data size (in bytes).
+ *
+ * @retval Number of bytes written to the output buffer.
+ */
+u32_t ring_buf_lf_get(struct ring_buf_lf *buf, u8_t *data, u32_t size);
+
 /**
  * @}
  */
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief public sys_rwlock APIs.
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_RWLOCK_H_
+#define ZEPHYR_INCLUDE_SYS_RWLOCK_H_
+
+/*
+ * sys_rwlock is a readers-writer lock which may reside in user memory. It
+ * is built on a k_futex: uncontended operations are atomic ops in user
+ * memory, only waiting and waking up waiters make syscalls. It requires
+ * CONFIG_USERSPACE.
+ *
+ * Readers are let in as long as no writer holds the lock, so a thread may
+ * lock it for reading recursively, but writers wait as long as readers
+ * keep the lock busy.
+ */
+
+#include <kernel.h>
+#include <sys/atomic.h>
+#include <zephyr/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * sys_rwlock structure
+ */
+struct sys_rwlock {
+	struct k_futex futex;
+};
+
+/**
+ * @brief Statically define and initialize a sys_rwlock
+ *
+ * Route this to memory domains using K_APP_DMEM().
+ *
+ * @param _name Name of the lock.
+ */
+#define SYS_RWLOCK_DEFINE(_name) \
+	struct sys_rwlock _name = { \
+		.futex = { 0 } \
+	}
+
+/**
+ * @brief Initialize a sys_rwlock.
+ *
+ * @param rwlock Address of the lock.
+ */
+static inline void sys_rwlock_init(struct sys_rwlock *rwlock)
+{
+	atomic_set(&rwlock->futex.val, 0);
+}
+
+/**
+ * @brief Lock a sys_rwlock for reading.
+ *
+ * Several threads may hold the lock for reading at the same time, as long
+ * as no thread holds it for writing.
+ *
+ * @param rwlock Address of the lock.
+ * @param timeout Waiting period to lock (in milliseconds), or one of the
+ *                special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Lock taken.
+ * @retval -ETIMEDOUT Waiting period timed out.
+ * @retval -EINVAL Parameter address not recognized.
+ * @retval -EACCES Caller does not have enough access.
+ */
+int sys_rwlock_rdlock(struct sys_rwlock *rwlock, s32_t timeout);
+
+/**
+ * @brief Lock a sys_rwlock for writing.
+ *
+ * @param rwlock Address of the lock.
+ * @param timeout Waiting period to lock (in milliseconds), or one of the
+ *                special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Lock taken.
+ * @retval -ETIMEDOUT Waiting period timed out.
+ * @retval -EINVAL Parameter address not recognized.
+ * @retval -EACCES Caller does not have enough access.
+ */
+int sys_rwlock_wrlock(struct sys_rwlock *rwlock, s32_t timeout);
+
+/**
+ * @brief Unlock a sys_rwlock.
+ *
+ * This routine releases a lock taken for reading or for writing.
+ *
+ * @param rwlock Address of the lock.
+ *
+ * @retval 0 Lock released.
+ * @retval -EINVAL Lock was not taken, or parameter address not recognized.
+ * @retval -EACCES Caller does not have enough access.
+ */
+int sys_rwlock_unlock(struct sys_rwlock *rwlock);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -33,6 +33,8 @@ extern "C" {
 struct sys_sem {
 #ifdef CONFIG_USERSPACE
 	struct k_futex futex;
+	/* Number of threads waiting, or about to, for the semaphore */
+	atomic_t waiters;
 	int limit;
 #else
 	struct k_sem kernel_sem;
@@ -139,6 +139,10 @@ struct _timeout {
 	sys_dnode_t node;
 	s32_t dticks;
 	_timeout_func_t fn;
+#ifdef CONFIG_TIMEOUT_SLACK
+	/* ticks the expiry may be delayed to share a wake-up */
+	s32_t slack;
+#endif
 };
 
 #ifdef __cplusplus
@@ -25,6 +25,9 @@ extern "C" {
 static inline void z_init_timeout(struct _timeout *t)
 {
 	sys_dnode_init(&t->node);
+#ifdef CONFIG_TIMEOUT_SLACK
+	t->slack = 0;
+#endif
 }
 
 void z_add_timeout(struct _timeout *to, _timeout_func_t fn, s32_t ticks);
@@ -8,6 +8,7 @@
 #include <device.h>
 #include <sys/atomic.h>
 #include <syscall_handler.h>
+#include <init.h>
 
 extern struct device __device_init_start[];
 extern struct device __device_PRE_KERNEL_1_start[];
@@ -23,6 +24,319 @@ extern u32_t __device_busy_end[];
 #define DEVICE_BUSY_SIZE (__device_busy_end - __device_busy_start)
 #endif
 
+#ifdef CONFIG_DEVICE_NAME_INDEX
+extern u16_t __device_name_index_start[];
+
+/* Number of devices in the index, 0 until all devices are initialized */
+static size_t device_name_index_cnt;
+
+static inline const char *device_name_index_name(size_t i)
+{
+	return __device_init_start[__device_name_index_start[i]].config->name;
+}
+
+/*
+ * Insertion sort of the ready devices by name. It is stable, so devices
+ * sharing a name stay in link order, as with the linear search.
+ */
+static void device_name_index_build(void)
+{
+	u16_t *index = __device_name_index_start;
+	size_t cnt = 0;
+	size_t i, j;
+
+	for (i = 0; i < __device_init_end - __device_init_start; i++) {
+		struct device *info = &__device_init_start[i];
+
+		if (info->driver_api == NULL) {
+			continue;
+		}
+
+		for (j = cnt; j > 0; j--) {
+			if (strcmp(device_name_index_name(j - 1),
+				   info->config->name) <= 0) {
+				break;
+			}
+			index[j] = index[j - 1];
+		}
+
+		index[j] = i;
+		cnt++;
+	}
+
+	device_name_index_cnt = cnt;
+}
+
+static struct device *device_name_index_find(const char *name)
+{
+	size_t lo = 0;
+	size_t hi = device_name_index_cnt;
+	size_t mid;
+
+	/* first entry not lower than name */
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		if (strcmp(device_name_index_name(mid), name) < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	if ((lo < device_name_index_cnt) &&
+	    (strcmp(device_name_index_name(lo), name) == 0)) {
+		return &__device_init_start[__device_name_index_start[lo]];
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_DEVICE_NAME_INDEX */
+
+#ifdef CONFIG_BOOT_TIME_MEASUREMENT
+extern u32_t __device_init_cycles_start[];
+#endif
+
+/*
+ * The system timer is only initialized in PRE_KERNEL_2, so init times are
+ * only measured from POST_KERNEL on.
+ */
+static void device_init_one(struct device *info, s32_t level)
+{
+	struct device_config *device_conf = info->config;
+	int retval;
+#ifdef CONFIG_BOOT_TIME_MEASUREMENT
+	bool timed = level >= _SYS_INIT_LEVEL_POST_KERNEL;
+	u32_t start = timed ? k_cycle_get_32() : 0;
+#endif
+
+	retval = device_conf->init(info);
+	if (retval != 0) {
+		/* Initialization failed. Clear the API struct so that
+		 * device_get_binding() will not succeed for it.
+		 */
+		info->driver_api = NULL;
+	} else {
+		z_object_init(info);
+	}
+
+#ifdef CONFIG_BOOT_TIME_MEASUREMENT
+	if (timed) {
+		__device_init_cycles_start[info - __device_init_start] =
+			k_cycle_get_32() - start;
+	}
+#endif
+}
+
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+/*
+ * Runs of devices declared with DEVICE_INIT_PARALLEL() and sharing a level
+ * and priority are shared between the calling thread and a few helper
+ * threads, each picking the next device whose dependencies are done. A
+ * device sleeping in its init function then lets the others make progress.
+ */
+#define DEVICE_INIT_THREADS CONFIG_DEVICE_INIT_PARALLEL_THREADS
+
+enum {
+	DEVICE_INIT_PENDING,
+	DEVICE_INIT_BUSY,
+	DEVICE_INIT_DONE,
+};
+
+static K_THREAD_STACK_ARRAY_DEFINE(device_init_stacks, DEVICE_INIT_THREADS,
+				   CONFIG_DEVICE_INIT_PARALLEL_STACK_SIZE);
+static struct k_thread device_init_threads[DEVICE_INIT_THREADS];
+static K_SEM_DEFINE(device_init_start_sem, 0, DEVICE_INIT_THREADS);
+static K_SEM_DEFINE(device_init_done_sem, 0, DEVICE_INIT_THREADS);
+/* Given to every thread whenever a device of the run is done */
+static K_SEM_DEFINE(device_init_progress_sem, 0, DEVICE_INIT_THREADS + 1);
+static bool device_init_threads_started;
+
+/* Devices being initialized, a NULL end tells the threads to exit */
+static struct device *device_init_run_start;
+static struct device *device_init_run_end;
+static s32_t device_init_run_level;
+
+static struct device_init_parallel *device_init_parallel_get(
+	struct device *info)
+{
+	Z_STRUCT_SECTION_FOREACH(device_init_parallel, entry) {
+		if (entry->dev == info) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+/* Whether the device named name is done, if it is part of the run */
+static bool device_init_dep_done(const char *name)
+{
+	struct device_init_parallel *entry;
+	struct device *info;
+
+	for (info = device_init_run_start; info < device_init_run_end;
+	     info++) {
+		if (strcmp(info->config->name, name) == 0) {
+			entry = device_init_parallel_get(info);
+			return atomic_get(&entry->state) == DEVICE_INIT_DONE;
+		}
+	}
+
+	return true;
+}
+
+static bool device_init_deps_done(struct device_init_parallel *entry)
+{
+	int i;
+
+	for (i = 0; i < entry->num_deps; i++) {
+		if (!device_init_dep_done(entry->deps[i])) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/*
+ * Claim a device of the run whose dependencies are done. pending tells
+ * whether some devices are still left to claim.
+ */
+static struct device_init_parallel *device_init_claim(bool *pending)
+{
+	struct device_init_parallel *entry;
+	struct device *info;
+
+	*pending = false;
+
+	for (info = device_init_run_start; info < device_init_run_end;
+	     info++) {
+		entry = device_init_parallel_get(info);
+		if (atomic_get(&entry->state) != DEVICE_INIT_PENDING) {
+			continue;
+		}
+
+		*pending = true;
+
+		if (device_init_deps_done(entry) &&
+		    atomic_cas(&entry->state, DEVICE_INIT_PENDING,
+			       DEVICE_INIT_BUSY)) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+static void device_init_run(void)
+{
+	struct device_init_parallel *entry;
+	bool pending;
+	int i;
+
+	while (true) {
+		entry = device_init_claim(&pending);
+		if (entry == NULL) {
+			if (!pending) {
+				break;
+			}
+
+			k_sem_take(&device_init_progress_sem, K_FOREVER);
+			continue;
+		}
+
+		device_init_one(entry->dev, device_init_run_level);
+		atomic_set(&entry->state, DEVICE_INIT_DONE);
+
+		for (i = 0; i <= DEVICE_INIT_THREADS; i++) {
+			k_sem_give(&device_init_progress_sem);
+		}
+	}
+}
+
+static void device_init_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&device_init_start_sem, K_FOREVER);
+		if (device_init_run_end == NULL) {
+			break;
+		}
+
+		device_init_run();
+		k_sem_give(&device_init_done_sem);
+	}
+}
+
+static void device_init_parallel(struct device *start, struct device *end,
+				 s32_t level)
+{
+	int helpers = MIN(end - start - 1, DEVICE_INIT_THREADS);
+	int i;
+
+	if (!device_init_threads_started) {
+		for (i = 0; i < DEVICE_INIT_THREADS; i++) {
+			k_thread_create(&device_init_threads[i],
+					device_init_stacks[i],
+					CONFIG_DEVICE_INIT_PARALLEL_STACK_SIZE,
+					device_init_thread, NULL, NULL, NULL,
+					CONFIG_MAIN_THREAD_PRIORITY, 0,
+					K_NO_WAIT);
+		}
+		device_init_threads_started = true;
+	}
+
+	k_sem_reset(&device_init_progress_sem);
+	device_init_run_start = start;
+	device_init_run_end = end;
+	device_init_run_level = level;
+
+	for (i = 0; i < helpers; i++) {
+		k_sem_give(&device_init_start_sem);
+	}
+
+	device_init_run();
+
+	for (i = 0; i < helpers; i++) {
+		k_sem_take(&device_init_done_sem, K_FOREVER);
+	}
+}
+
+static void device_init_threads_stop(void)
+{
+	int i;
+
+	if (!device_init_threads_started) {
+		return;
+	}
+
+	device_init_run_end = NULL;
+	for (i = 0; i < DEVICE_INIT_THREADS; i++) {
+		k_sem_give(&device_init_start_sem);
+	}
+}
+
+/*
+ * First device past the run of parallel devices sharing the priority of
+ * info, info itself if it is not a parallel device.
+ */
+static struct device *device_init_run_find(struct device *info,
+					   struct device *end)
+{
+	u8_t prio = info->config->init_priority;
+
+	while (info < end && info->config->init_priority == prio &&
+	       device_init_parallel_get(info) != NULL) {
+		info++;
+	}
+
+	return info;
+}
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+
 /**
  * @brief Execute all the device initialization functions at a given level
  *
@@ -48,25 +362,45 @@ void z_sys_device_do_config_level(s32_t level)
 
 	for (info = config_levels[level]; info < config_levels[level+1];
 								info++) {
-		int retval;
-		struct device_config *device_conf = info->config;
-
-		retval = device_conf->init(info);
-		if (retval != 0) {
-			/* Initialization failed. Clear the API struct so that
-			 * device_get_binding() will not succeed for it.
-			 */
-			info->driver_api = NULL;
-		} else {
-			z_object_init(info);
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+		if (level >= _SYS_INIT_LEVEL_POST_KERNEL) {
+			struct device *end;
+
+			end = device_init_run_find(info,
+						   config_levels[level+1]);
+			if (end - info > 1) {
+				device_init_parallel(info, end, level);
+				info = end - 1;
+				continue;
+			}
 		}
+#endif
+		device_init_one(info, level);
 	}
+
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+	if (level == _SYS_INIT_LEVEL_APPLICATION) {
+		device_init_threads_stop();
+	}
+#endif
+
+#ifdef CONFIG_DEVICE_NAME_INDEX
+	if (level == _SYS_INIT_LEVEL_APPLICATION) {
+		device_name_index_build();
+	}
+#endif
 }
 
 struct device *z_impl_device_get_binding(const char *name)
 {
 	struct device *info;
 
+#ifdef CONFIG_DEVICE_NAME_INDEX
+	if (device_name_index_cnt) {
+		return device_name_index_find(name);
+	}
+#endif
+
 	/* Split the search into two loops: in the common scenario, where
 	 * device names are stored in ROM (and are referenced by the user
 	 * with CONFIG_* macros), only cheap pointer comparisons will be
@@ -121,6 +121,11 @@ extern int z_stack_adjust_initialized;
 #ifdef CONFIG_BOOT_TIME_MEASUREMENT
 extern u32_t z_timestamp_main; /* timestamp when main task starts */
 extern u32_t z_timestamp_idle; /* timestamp when CPU goes idle */
+
+/* init time of each device, in cycles, in the order of __device_init_start */
+extern struct device __device_init_start[];
+extern struct device __device_init_end[];
+extern u32_t __device_init_cycles_start[];
 #endif
 
 extern struct k_thread z_main_thread;
@@ -247,6 +247,226 @@ static inline int z_vrfy_k_msgq_get(struct k_msgq *q, void *data, s32_t timeout)
 #include <syscalls/k_msgq_get_mrsh.c>
 #endif
 
+/* Copy @a count messages into the ring, there must be room for them */
+static void msgq_ring_write(struct k_msgq *msgq, const char *data,
+			    u32_t count)
+{
+	size_t len = count * msgq->msg_size;
+	size_t first = MIN(len, (size_t)(msgq->buffer_end - msgq->write_ptr));
+
+	(void)memcpy(msgq->write_ptr, data, first);
+	(void)memcpy(msgq->buffer_start, data + first, len - first);
+
+	if (len > first) {
+		msgq->write_ptr = msgq->buffer_start + (len - first);
+	} else {
+		msgq->write_ptr += first;
+		if (msgq->write_ptr == msgq->buffer_end) {
+			msgq->write_ptr = msgq->buffer_start;
+		}
+	}
+	msgq->used_msgs += count;
+}
+
+/* Copy @a count messages out of the ring, there must be that many */
+static void msgq_ring_read(struct k_msgq *msgq, char *data, u32_t count)
+{
+	size_t len = count * msgq->msg_size;
+	size_t first = MIN(len, (size_t)(msgq->buffer_end - msgq->read_ptr));
+
+	(void)memcpy(data, msgq->read_ptr, first);
+	(void)memcpy(data + first, msgq->buffer_start, len - first);
+
+	if (len > first) {
+		msgq->read_ptr = msgq->buffer_start + (len - first);
+	} else {
+		msgq->read_ptr += first;
+		if (msgq->read_ptr == msgq->buffer_end) {
+			msgq->read_ptr = msgq->buffer_start;
+		}
+	}
+	msgq->used_msgs -= count;
+}
+
+/* Hand queued messages to threads waiting to receive, if any */
+static bool msgq_wake_getters(struct k_msgq *msgq)
+{
+	struct k_thread *pending_thread;
+	bool woken = false;
+
+	while (msgq->used_msgs > 0) {
+		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (pending_thread == NULL) {
+			break;
+		}
+
+		msgq_ring_read(msgq, pending_thread->base.swap_data, 1);
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		woken = true;
+	}
+
+	return woken;
+}
+
+/* Queue the messages of threads waiting to send, if any */
+static bool msgq_wake_putters(struct k_msgq *msgq)
+{
+	struct k_thread *pending_thread;
+	bool woken = false;
+
+	while (msgq->used_msgs < msgq->max_msgs) {
+		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (pending_thread == NULL) {
+			break;
+		}
+
+		msgq_ring_write(msgq, pending_thread->base.swap_data, 1);
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		woken = true;
+	}
+
+	return woken;
+}
+
+int z_impl_k_msgq_put_n(struct k_msgq *msgq, void *data, u32_t count,
+			s32_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || timeout == K_NO_WAIT, "");
+
+	k_spinlock_key_t key;
+	u32_t n;
+	int ret;
+
+	key = k_spin_lock(&msgq->lock);
+
+	n = MIN(count, msgq->max_msgs - msgq->used_msgs);
+
+	if (n > 0) {
+		/* Threads can only be waiting to receive from an empty
+		 * queue, they get the first messages of the batch.
+		 */
+		msgq_ring_write(msgq, data, n);
+		if (msgq_wake_getters(msgq)) {
+			z_reschedule(&msgq->lock, key);
+			return n;
+		}
+	} else if (count > 0 && timeout != K_NO_WAIT) {
+		/* Full queue, wait until the first message can be sent */
+		_current->base.swap_data = data;
+		ret = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		return ret == 0 ? 1 : ret;
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return n;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_put_n(struct k_msgq *q, void *data,
+				      u32_t count, s32_t timeout)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(q, K_OBJ_MSGQ));
+	Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_READ(data, count, q->msg_size));
+
+	return z_impl_k_msgq_put_n(q, data, count, timeout);
+}
+#include <syscalls/k_msgq_put_n_mrsh.c>
+#endif
+
+int z_impl_k_msgq_get_n(struct k_msgq *msgq, void *data, u32_t count,
+			s32_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || timeout == K_NO_WAIT, "");
+
+	k_spinlock_key_t key;
+	u32_t n;
+	int ret;
+
+	key = k_spin_lock(&msgq->lock);
+
+	n = MIN(count, msgq->used_msgs);
+
+	if (n > 0) {
+		/* Threads can only be waiting to send to a full queue, the
+		 * room just made is given to them.
+		 */
+		msgq_ring_read(msgq, data, n);
+		if (msgq_wake_putters(msgq)) {
+			z_reschedule(&msgq->lock, key);
+			return n;
+		}
+	} else if (count > 0 && timeout != K_NO_WAIT) {
+		/* Empty queue, wait until one message can be received */
+		_current->base.swap_data = data;
+		ret = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		return ret == 0 ? 1 : ret;
+	}
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return n;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_get_n(struct k_msgq *q, void *data,
+				      u32_t count, s32_t timeout)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(q, K_OBJ_MSGQ));
+	Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_WRITE(data, count, q->msg_size));
+
+	return z_impl_k_msgq_get_n(q, data, count, timeout);
+}
+#include <syscalls/k_msgq_get_n_mrsh.c>
+#endif
+
+u32_t k_msgq_put_reserve(struct k_msgq *msgq, void **data, u32_t count)
+{
+	k_spinlock_key_t key;
+	u32_t contiguous;
+
+	key = k_spin_lock(&msgq->lock);
+
+	/* Slots are only handed out up to the end of the buffer */
+	contiguous = (msgq->buffer_end - msgq->write_ptr) / msgq->msg_size;
+	count = MIN(count, msgq->max_msgs - msgq->used_msgs);
+	count = MIN(count, contiguous);
+	*data = msgq->write_ptr;
+
+	k_spin_unlock(&msgq->lock, key);
+
+	return count;
+}
+
+void k_msgq_put_commit(struct k_msgq *msgq, u32_t count)
+{
+	k_spinlock_key_t key;
+
+	if (count == 0) {
+		return;
+	}
+
+	key = k_spin_lock(&msgq->lock);
+
+	__ASSERT(count <= msgq->max_msgs - msgq->used_msgs &&
+		 count <= (msgq->buffer_end - msgq->write_ptr) /
+			  msgq->msg_size, "more messages than reserved");
+
+	msgq->write_ptr += count * msgq->msg_size;
+	if (msgq->write_ptr == msgq->buffer_end) {
+		msgq->write_ptr = msgq->buffer_start;
+	}
+	msgq->used_msgs += count;
+
+	if (msgq_wake_getters(msgq)) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+}
+
 int z_impl_k_msgq_peek(struct k_msgq *msgq, void *data)
 {
 	k_spinlock_key_t key;
@@ -90,6 +90,87 @@ static inline void z_vrfy_k_mutex_init(struct k_mutex *mutex)
 #include <syscalls/k_mutex_init_mrsh.c>
 #endif
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+static struct k_mutex_spin_stats spin_stats;
+
+static bool owner_running(struct k_thread *owner)
+{
+	int i;
+
+	for (i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		if (_kernel.cpus[i].current == owner) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/*
+ * Called with the lock held, when the mutex is owned by another thread.
+ * While that thread runs on another CPU, it may well release the mutex
+ * sooner than a context switch would take, so watch the mutex for a
+ * while instead of pending. The checks done without the lock are only
+ * hints; the outcome is settled once it is taken back.
+ *
+ * The spin never lasts longer than the timeout, and the time spent
+ * spinning, in whole milliseconds, is taken off it.
+ *
+ * Returns with the lock held, true if the mutex is free.
+ */
+static bool mutex_spin(struct k_mutex *mutex, k_spinlock_key_t *key,
+		       s32_t *timeout)
+{
+	struct k_thread *owner = mutex->owner;
+	u32_t start = k_cycle_get_32();
+	u32_t limit_us = CONFIG_MUTEX_ADAPTIVE_SPIN_TIME;
+	u32_t limit;
+
+	if (*timeout != K_FOREVER) {
+		limit_us = MIN(limit_us, (u64_t)*timeout * USEC_PER_MSEC);
+	}
+	limit = k_us_to_cyc_ceil32(limit_us);
+
+	/* Waiters already pended get the mutex first on release */
+	if ((z_waitq_head(&mutex->wait_q) != NULL) || !owner_running(owner)) {
+		return false;
+	}
+
+	k_spin_unlock(&lock, *key);
+
+	while (*(volatile u32_t *)&mutex->lock_count != 0U) {
+		owner = *(struct k_thread * volatile *)&mutex->owner;
+		if ((k_cycle_get_32() - start >= limit) ||
+		    !owner_running(owner)) {
+			break;
+		}
+	}
+
+	*key = k_spin_lock(&lock);
+
+	if (*timeout != K_FOREVER) {
+		*timeout -= MIN((u32_t)*timeout,
+				k_cyc_to_ms_floor32(k_cycle_get_32() - start));
+	}
+
+	if (mutex->lock_count == 0U) {
+		spin_stats.spin_acquired++;
+		return true;
+	}
+
+	spin_stats.spin_failed++;
+	return false;
+}
+
+void k_mutex_spin_stats_get(struct k_mutex_spin_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	*stats = spin_stats;
+	k_spin_unlock(&lock, key);
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 static s32_t new_prio_for_inheritance(s32_t target, s32_t limit)
 {
 	int new_prio = z_is_prio_higher(target, limit) ? target : limit;
@@ -122,6 +203,18 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, s32_t timeout)
 	sys_trace_void(SYS_TRACE_ID_MUTEX_LOCK);
 	key = k_spin_lock(&lock);
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	if ((mutex->lock_count != 0U) && (mutex->owner != _current) &&
+	    (timeout != (s32_t)K_NO_WAIT) &&
+	    !mutex_spin(mutex, &key, &timeout) &&
+	    (timeout == (s32_t)K_NO_WAIT)) {
+		/* The spin used up the whole timeout */
+		k_spin_unlock(&lock, key);
+		sys_trace_end_call(SYS_TRACE_ID_MUTEX_LOCK);
+		return -EAGAIN;
+	}
+#endif
+
 	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
 
 		mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
@@ -156,6 +249,10 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, s32_t timeout)
 		resched = adjust_owner_prio(mutex, new_prio);
 	}
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	spin_stats.blocked++;
+#endif
+
 	int got_mutex = z_pend_curr(&lock, key, &mutex->wait_q, timeout);
 
 	K_DEBUG("on mutex %p got_mutex value: %d\n", mutex, got_mutex);
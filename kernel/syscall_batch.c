@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <kernel.h>
+#include <string.h>
+#include <kernel_structs.h>
+#include <syscall_handler.h>
+
+/*
+ * A user thread queues system calls in a ring in its own memory and has
+ * them executed with a single trap. The ring is validated once per batch;
+ * each call is then dispatched to its regular marshalling handler, so it
+ * gets exactly the same object and argument checks as a direct call.
+ *
+ * Supervisor threads do not trap, the calls are made directly.
+ */
+
+#define NO_TIMEOUT -1
+
+struct batch_op {
+	u32_t id;
+	/* Index of the timeout argument, NO_TIMEOUT if there is none */
+	s8_t timeout_arg;
+	int (*impl)(uintptr_t *args);
+};
+
+static int batch_sem_give(uintptr_t *args)
+{
+	z_impl_k_sem_give((struct k_sem *)args[0]);
+
+	return 0;
+}
+
+static int batch_sem_take(uintptr_t *args)
+{
+	return z_impl_k_sem_take((struct k_sem *)args[0], K_NO_WAIT);
+}
+
+static int batch_msgq_put(uintptr_t *args)
+{
+	return z_impl_k_msgq_put((struct k_msgq *)args[0], (void *)args[1],
+				 K_NO_WAIT);
+}
+
+static int batch_msgq_get(uintptr_t *args)
+{
+	return z_impl_k_msgq_get((struct k_msgq *)args[0], (void *)args[1],
+				 K_NO_WAIT);
+}
+
+#ifdef CONFIG_POLL
+static int batch_poll_signal_raise(uintptr_t *args)
+{
+	return z_impl_k_poll_signal_raise((struct k_poll_signal *)args[0],
+					  (int)args[1]);
+}
+#endif
+
+static const struct batch_op batch_ops[] = {
+	{ K_SYSCALL_K_SEM_GIVE, NO_TIMEOUT, batch_sem_give },
+	{ K_SYSCALL_K_SEM_TAKE, 1, batch_sem_take },
+	{ K_SYSCALL_K_MSGQ_PUT, 2, batch_msgq_put },
+	{ K_SYSCALL_K_MSGQ_GET, 2, batch_msgq_get },
+#ifdef CONFIG_POLL
+	{ K_SYSCALL_K_POLL_SIGNAL_RAISE, NO_TIMEOUT, batch_poll_signal_raise },
+#endif
+};
+
+static const struct batch_op *batch_op_find(u32_t id)
+{
+	for (int i = 0; i < ARRAY_SIZE(batch_ops); i++) {
+		if (batch_ops[i].id == id) {
+			return &batch_ops[i];
+		}
+	}
+
+	return NULL;
+}
+
+static int ring_enter(struct k_syscall_ring *ring, bool user)
+{
+	struct k_syscall_batch_entry *entries;
+	u32_t size, start, head, tail;
+	int ret = 0;
+
+	/* Read the ring state once, the thread may keep changing it */
+	entries = ring->entries;
+	size = ring->size;
+	start = head = ring->head;
+	tail = ring->tail;
+
+	if (size == 0U || (size & (size - 1U)) != 0U || tail - head > size) {
+		return -EINVAL;
+	}
+
+	if (user) {
+		Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_WRITE(entries, size,
+						    sizeof(entries[0])));
+	}
+
+	for (; head != tail; head++) {
+		struct k_syscall_batch_entry *entry;
+		const struct batch_op *op;
+		uintptr_t args[K_SYSCALL_BATCH_ARGS];
+
+		entry = &entries[head & (size - 1U)];
+		op = batch_op_find(entry->id);
+
+		/* Work on a copy, the handlers validate what they get */
+		(void)memcpy(args, entry->args, sizeof(args));
+
+		if (op == NULL || (op->timeout_arg != NO_TIMEOUT &&
+				   (s32_t)args[op->timeout_arg] != K_NO_WAIT)) {
+			ret = -EINVAL;
+			break;
+		}
+
+		if (user) {
+			entry->result = (int)_k_syscall_table[op->id](args[0],
+					args[1], args[2], args[3], 0, 0,
+					_current_cpu->syscall_frame);
+		} else {
+			entry->result = op->impl(args);
+		}
+	}
+
+	ring->head = head;
+
+	return ret == 0 ? (int)(head - start) : ret;
+}
+
+int z_impl_k_syscall_ring_enter(struct k_syscall_ring *ring)
+{
+	return ring_enter(ring, false);
+}
+
+static inline int z_vrfy_k_syscall_ring_enter(struct k_syscall_ring *ring)
+{
+	Z_OOPS(Z_SYSCALL_MEMORY_WRITE(ring, sizeof(*ring)));
+
+	return ring_enter(ring, true);
+}
+#include <syscalls/k_syscall_ring_enter_mrsh.c>
@@ -69,11 +69,43 @@ static s32_t elapsed(void)
 	return announce_remaining == 0 ? z_clock_elapsed() : 0;
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/* Returns the latest expiry, relative to the current tick, which is not
+ * past the slack of any timeout: every timeout due by then is handled in
+ * the same wake-up. It is always the expiry of one of the timeouts, so at
+ * least one of them is on time.
+ */
+static s32_t coalesced_dticks(struct _timeout *to)
+{
+	s64_t ticks = to->dticks;
+	s64_t expiry = ticks;
+	s64_t limit = MIN(ticks + to->slack, INT_MAX);
+
+	for (to = next(to); to != NULL; to = next(to)) {
+		ticks += to->dticks;
+		if (ticks > limit) {
+			break;
+		}
+
+		expiry = ticks;
+		limit = MIN(limit, ticks + to->slack);
+	}
+
+	return (s32_t)expiry;
+}
+#else
+static s32_t coalesced_dticks(struct _timeout *to)
+{
+	return to->dticks;
+}
+#endif
+
 static s32_t next_timeout(void)
 {
 	struct _timeout *to = first();
 	s32_t ticks_elapsed = elapsed();
-	s32_t ret = to == NULL ? MAX_WAIT : MAX(0, to->dticks - ticks_elapsed);
+	s32_t ret = to == NULL ? MAX_WAIT :
+		MAX(0, coalesced_dticks(to) - ticks_elapsed);
 
 #ifdef CONFIG_TIMESLICING
 	if (_current_cpu->slice_ticks && _current_cpu->slice_ticks < ret) {
@@ -91,8 +123,16 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn, s32_t ticks)
 
 	LOCKED(&timeout_lock) {
 		struct _timeout *t;
+		bool reprogram = false;
 
 		to->dticks = ticks + elapsed();
+#ifdef CONFIG_TIMEOUT_SLACK
+		/* The system timer may be programmed for a coalesced expiry
+		 * past the new timeout, even if it is not the first one.
+		 */
+		reprogram = first() != NULL &&
+			    to->dticks < coalesced_dticks(first());
+#endif
 		for (t = first(); t != NULL; t = next(t)) {
 			__ASSERT(t->dticks >= 0, "");
 
@@ -108,7 +148,7 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn, s32_t ticks)
 			sys_dlist_append(&timeout_list, &to->node);
 		}
 
-		if (to == first()) {
+		if (to == first() || reprogram) {
 			z_clock_set_timeout(next_timeout(), false);
 		}
 	}
@@ -134,6 +134,26 @@ static inline void z_vrfy_k_timer_start(struct k_timer *timer,
 #include <syscalls/k_timer_start_mrsh.c>
 #endif
 
+#ifdef CONFIG_TIMEOUT_SLACK
+void z_impl_k_timer_slack_set(struct k_timer *timer, s32_t slack)
+{
+	__ASSERT(slack >= 0, "invalid parameters\n");
+
+	timer->timeout.slack = k_ms_to_ticks_floor32(slack);
+}
+
+#ifdef CONFIG_USERSPACE
+static inline void z_vrfy_k_timer_slack_set(struct k_timer *timer,
+					    s32_t slack)
+{
+	Z_OOPS(Z_SYSCALL_VERIFY(slack >= 0));
+	Z_OOPS(Z_SYSCALL_OBJ(timer, K_OBJ_TIMER));
+	z_impl_k_timer_slack_set(timer, slack);
+}
+#include <syscalls/k_timer_slack_set_mrsh.c>
+#endif
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 void z_impl_k_timer_stop(struct k_timer *timer)
 {
 	int inactive = z_abort_timeout(&timer->timeout) != 0;
@@ -35,6 +35,169 @@ void k_work_q_start(struct k_work_q *work_q, k_thread_stack_t *stack,
 	k_thread_name_set(&work_q->thread, WORKQUEUE_THREAD_NAME);
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+static k_thread_stack_t *pool_stack(struct k_work_q_pool *pool, int i)
+{
+	return (k_thread_stack_t *)((char *)pool->stacks +
+				    i * pool->stack_stride);
+}
+
+static bool pool_key_running(struct k_work_q_pool *pool, u32_t key)
+{
+	int i;
+
+	for (i = 0; i < pool->nthreads; i++) {
+		if (pool->keys[i] == key) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/*
+ * Work items out of the queue are linked in the deferred list through
+ * their _reserved member, as the queue does.
+ */
+static struct k_work *pool_deferred_get(struct k_work_q_pool *pool,
+					u32_t key)
+{
+	sys_snode_t *node, *prev = NULL;
+
+	SYS_SLIST_FOR_EACH_NODE(&pool->deferred, node) {
+		struct k_work *work = (struct k_work *)node;
+
+		if (work->key == key) {
+			sys_slist_remove(&pool->deferred, prev, node);
+			pool->deferred_cnt--;
+			return work;
+		}
+
+		prev = node;
+	}
+
+	return NULL;
+}
+
+static void pool_work_run(struct k_work_q_pool *pool, struct k_work *work)
+{
+	u32_t latency = k_cycle_get_32() - work->timestamp;
+	k_work_handler_t handler = work->handler;
+	k_spinlock_key_t key;
+
+	/* Reset pending state so it can be resubmitted by handler */
+	if (!atomic_test_and_clear_bit(work->flags, K_WORK_STATE_PENDING)) {
+		return;
+	}
+
+	key = k_spin_lock(&pool->lock);
+	pool->processed++;
+	pool->latency_total += latency;
+	pool->latency_max = MAX(pool->latency_max, latency);
+	k_spin_unlock(&pool->lock, key);
+
+	handler(work);
+}
+
+static void pool_main(void *pool_ptr, void *idx_ptr, void *p3)
+{
+	struct k_work_q_pool *pool = pool_ptr;
+	int idx = POINTER_TO_INT(idx_ptr);
+	struct k_work *work;
+	k_spinlock_key_t key;
+
+	ARG_UNUSED(p3);
+
+	while (true) {
+		work = k_queue_get(&pool->work_q.queue, K_FOREVER);
+		if (work == NULL) {
+			continue;
+		}
+
+		key = k_spin_lock(&pool->lock);
+		if (work->key != 0U && pool_key_running(pool, work->key)) {
+			/* Left to the worker running this key */
+			sys_slist_append(&pool->deferred, (sys_snode_t *)work);
+			pool->deferred_cnt++;
+			k_spin_unlock(&pool->lock, key);
+			continue;
+		}
+
+		pool->keys[idx] = work->key;
+		k_spin_unlock(&pool->lock, key);
+
+		/* Also run the items of the same key submitted meanwhile,
+		 * the key is kept so that they stay in order.
+		 */
+		do {
+			pool_work_run(pool, work);
+
+			key = k_spin_lock(&pool->lock);
+			work = NULL;
+			if (pool->keys[idx] != 0U) {
+				work = pool_deferred_get(pool, pool->keys[idx]);
+			}
+
+			if (work == NULL) {
+				pool->keys[idx] = 0U;
+			}
+			k_spin_unlock(&pool->lock, key);
+		} while (work != NULL);
+
+		/* Make sure we don't hog up the CPU if the FIFO never (or
+		 * very rarely) gets empty.
+		 */
+		k_yield();
+	}
+}
+
+void k_work_q_pool_start(struct k_work_q_pool *pool, int prio)
+{
+	struct k_thread *thread;
+	int i;
+
+	k_queue_init(&pool->work_q.queue);
+	sys_slist_init(&pool->deferred);
+
+	for (i = 0; i < pool->nthreads; i++) {
+		thread = (i == 0) ? &pool->work_q.thread :
+				    &pool->threads[i - 1];
+
+		(void)k_thread_create(thread, pool_stack(pool, i),
+				      pool->stack_size, pool_main, pool,
+				      INT_TO_POINTER(i), NULL, prio, 0,
+				      K_NO_WAIT);
+		k_thread_name_set(thread, WORKQUEUE_THREAD_NAME);
+	}
+}
+
+void k_work_q_pool_stats_get(struct k_work_q_pool *pool,
+			     struct k_work_q_pool_stats *stats)
+{
+	struct k_queue *queue = &pool->work_q.queue;
+	sys_sfnode_t *node;
+	k_spinlock_key_t key;
+	u32_t depth = 0U;
+
+	key = k_spin_lock(&queue->lock);
+	SYS_SFLIST_FOR_EACH_NODE(&queue->data_q, node) {
+		depth++;
+	}
+	k_spin_unlock(&queue->lock, key);
+
+	key = k_spin_lock(&pool->lock);
+	stats->depth = depth + pool->deferred_cnt;
+	stats->processed = pool->processed;
+	stats->latency_max = k_cyc_to_us_ceil32(pool->latency_max);
+	stats->latency_avg = 0U;
+	if (pool->processed != 0U) {
+		stats->latency_avg = k_cyc_to_us_ceil32(
+			(u32_t)(pool->latency_total / pool->processed));
+	}
+	k_spin_unlock(&pool->lock, key);
+}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 #ifdef CONFIG_SYS_CLOCK_EXISTS
 static void work_timeout(struct _timeout *t)
 {
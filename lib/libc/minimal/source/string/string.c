@@ -10,6 +10,24 @@
 #include <stdint.h>
 #include <sys/types.h>
 
+#define MEM_WORD_MASK	(sizeof(mem_word_t) - 1)
+
+/* Every byte of the word set to 0x01, resp. 0x80 */
+#define MEM_WORD_ONES	((mem_word_t)-1 / 0xff)
+#define MEM_WORD_HIGHS	(MEM_WORD_ONES << 7)
+
+/*
+ * Non-zero if any byte of the word is zero. Bytes above a zero byte may be
+ * flagged wrongly, so the exact position has to be found byte by byte.
+ */
+#define MEM_WORD_HAS_ZERO(w) \
+	(((w) - MEM_WORD_ONES) & ~(w) & MEM_WORD_HIGHS)
+
+static inline mem_word_t mem_word_repeat(unsigned char c)
+{
+	return MEM_WORD_ONES * c;
+}
+
 /**
  *
  * @brief Copy a string
@@ -106,14 +124,28 @@ char *strrchr(const char *s, int c)
 
 size_t strlen(const char *s)
 {
-	size_t n = 0;
+	const char *p = s;
+	const mem_word_t *w;
 
-	while (*s != '\0') {
-		s++;
-		n++;
+	/* Aligned word reads never cross into a page the string is not in */
+	while ((uintptr_t)p & MEM_WORD_MASK) {
+		if (*p == '\0') {
+			return p - s;
+		}
+		p++;
 	}
 
-	return n;
+	w = (const mem_word_t *)p;
+	while (!MEM_WORD_HAS_ZERO(*w)) {
+		w++;
+	}
+
+	p = (const char *)w;
+	while (*p != '\0') {
+		p++;
+	}
+
+	return p - s;
 }
 
 /**
@@ -125,14 +157,9 @@ size_t strlen(const char *s)
 
 size_t strnlen(const char *s, size_t maxlen)
 {
-	size_t n = 0;
-
-	while (*s != '\0' && n < maxlen) {
-		s++;
-		n++;
-	}
+	const char *p = memchr(s, '\0', maxlen);
 
-	return n;
+	return (p != NULL) ? (size_t)(p - s) : maxlen;
 }
 
 /**
@@ -199,19 +226,45 @@ char *strncat(char *_MLIBC_RESTRICT dest, const char *_MLIBC_RESTRICT src,
  */
 int memcmp(const void *m1, const void *m2, size_t n)
 {
-	const char *c1 = m1;
-	const char *c2 = m2;
+	const unsigned char *c1 = m1;
+	const unsigned char *c2 = m2;
+
+	/* skip equal words if both buffers have the same alignment */
+	if ((n >= 2 * sizeof(mem_word_t)) &&
+	    ((((uintptr_t)c1 ^ (uintptr_t)c2) & MEM_WORD_MASK) == 0)) {
+		while ((uintptr_t)c1 & MEM_WORD_MASK) {
+			if (*c1 != *c2) {
+				return *c1 - *c2;
+			}
+			c1++;
+			c2++;
+			n--;
+		}
 
-	if (!n) {
-		return 0;
+		const mem_word_t *w1 = (const mem_word_t *)c1;
+		const mem_word_t *w2 = (const mem_word_t *)c2;
+
+		while ((n >= sizeof(mem_word_t)) && (*w1 == *w2)) {
+			w1++;
+			w2++;
+			n -= sizeof(mem_word_t);
+		}
+
+		c1 = (const unsigned char *)w1;
+		c2 = (const unsigned char *)w2;
 	}
 
-	while ((--n > 0) && (*c1 == *c2)) {
+	/* the first differing byte decides, as unsigned char */
+	while (n > 0) {
+		if (*c1 != *c2) {
+			return *c1 - *c2;
+		}
 		c1++;
 		c2++;
+		n--;
 	}
 
-	return *c1 - *c2;
+	return 0;
 }
 
 /**
@@ -236,6 +289,9 @@ void *memmove(void *d, const void *s, size_t n)
 			n--;
 			dest[n] = src[n];
 		}
+	} else if ((size_t)(src - dest) >= n) {
+		/* The buffers do not overlap at all */
+		return memcpy(d, s, n);
 	} else {
 		/* It is safe to perform a forward-copy */
 		while (n > 0) {
@@ -258,36 +314,63 @@ void *memmove(void *d, const void *s, size_t n)
 
 void *memcpy(void *_MLIBC_RESTRICT d, const void *_MLIBC_RESTRICT s, size_t n)
 {
-	/* attempt word-sized copying only if buffers have identical alignment */
-
 	unsigned char *d_byte = (unsigned char *)d;
 	const unsigned char *s_byte = (const unsigned char *)s;
-	const uintptr_t mask = sizeof(mem_word_t) - 1;
 
-	if ((((uintptr_t)d ^ (uintptr_t)s_byte) & mask) == 0) {
+	if (n >= 2 * sizeof(mem_word_t)) {
 
-		/* do byte-sized copying until word-aligned or finished */
+		/* do byte-sized copying until the destination is aligned */
 
-		while (((uintptr_t)d_byte) & mask) {
-			if (n == 0) {
-				return d;
-			}
+		while (((uintptr_t)d_byte) & MEM_WORD_MASK) {
 			*(d_byte++) = *(s_byte++);
 			n--;
-		};
-
-		/* do word-sized copying as long as possible */
+		}
 
 		mem_word_t *d_word = (mem_word_t *)d_byte;
-		const mem_word_t *s_word = (const mem_word_t *)s_byte;
+		uintptr_t s_off = (uintptr_t)s_byte & MEM_WORD_MASK;
 
-		while (n >= sizeof(mem_word_t)) {
-			*(d_word++) = *(s_word++);
-			n -= sizeof(mem_word_t);
+		if (s_off == 0) {
+			/* do word-sized copying as long as possible */
+
+			const mem_word_t *s_word = (const mem_word_t *)s_byte;
+
+			while (n >= sizeof(mem_word_t)) {
+				*(d_word++) = *(s_word++);
+				n -= sizeof(mem_word_t);
+			}
+
+			s_byte = (const unsigned char *)s_word;
+		} else {
+			/*
+			 * Misaligned source: read aligned words and shift
+			 * every destination word together from two of them.
+			 * Aligned reads never go past the word holding the
+			 * last source byte.
+			 */
+
+			const unsigned int lo = s_off * 8U;
+			const unsigned int hi = Z_MEM_WORD_T_WIDTH - lo;
+			const mem_word_t *s_word =
+				(const mem_word_t *)(s_byte - s_off);
+			mem_word_t cur = *(s_word++);
+			mem_word_t next;
+
+			while (n >= sizeof(mem_word_t)) {
+				next = *(s_word++);
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+				*(d_word++) = (cur << lo) | (next >> hi);
+#else
+				*(d_word++) = (cur >> lo) | (next << hi);
+#endif
+				cur = next;
+				n -= sizeof(mem_word_t);
+			}
+
+			s_byte = (const unsigned char *)s_word -
+				 sizeof(mem_word_t) + s_off;
 		}
 
 		d_byte = (unsigned char *)d_word;
-		s_byte = (unsigned char *)s_word;
 	}
 
 	/* do byte-sized copying until finished */
@@ -325,13 +408,7 @@ void *memset(void *buf, int c, size_t n)
 	/* do word-sized initialization as long as possible */
 
 	mem_word_t *d_word = (mem_word_t *)d_byte;
-	mem_word_t c_word = (mem_word_t)c_byte;
-
-	c_word |= c_word << 8;
-	c_word |= c_word << 16;
-#if Z_MEM_WORD_T_WIDTH > 32
-	c_word |= c_word << 32;
-#endif
+	mem_word_t c_word = mem_word_repeat(c_byte);
 
 	while (n >= sizeof(mem_word_t)) {
 		*(d_word++) = c_word;
@@ -359,15 +436,37 @@ void *memset(void *buf, int c, size_t n)
 
 void *memchr(const void *s, int c, size_t n)
 {
-	if (n != 0) {
-		const unsigned char *p = s;
+	const unsigned char *p = s;
+	const unsigned char c_byte = (unsigned char)c;
 
-		do {
-			if (*p++ == (unsigned char)c) {
-				return ((void *)(p - 1));
+	if (n >= 2 * sizeof(mem_word_t)) {
+		while ((uintptr_t)p & MEM_WORD_MASK) {
+			if (*p == c_byte) {
+				return (void *)p;
 			}
+			p++;
+			n--;
+		}
 
-		} while (--n != 0);
+		/* a byte equal to c is a zero byte once xor-ed with c */
+		const mem_word_t c_word = mem_word_repeat(c_byte);
+		const mem_word_t *w = (const mem_word_t *)p;
+
+		while ((n >= sizeof(mem_word_t)) &&
+		       !MEM_WORD_HAS_ZERO(*w ^ c_word)) {
+			w++;
+			n -= sizeof(mem_word_t);
+		}
+
+		p = (const unsigned char *)w;
+	}
+
+	while (n > 0) {
+		if (*p == c_byte) {
+			return (void *)p;
+		}
+		p++;
+		n--;
 	}
 
 	return NULL;
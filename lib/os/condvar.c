@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <sys/condvar.h>
+
+/*
+ * Waiters sleep as long as the sequence number they read before releasing
+ * the mutex is unchanged. The waiters count, raised before that read, lets
+ * signals skip the syscall when nobody waits.
+ */
+int sys_condvar_wait(struct sys_condvar *condvar, struct sys_mutex *mutex,
+		     s32_t timeout)
+{
+	atomic_val_t seq;
+	int ret;
+
+	atomic_inc(&condvar->waiters);
+	seq = atomic_get(&condvar->futex.val);
+
+	ret = sys_mutex_unlock(mutex);
+	if (ret != 0) {
+		atomic_dec(&condvar->waiters);
+		return ret;
+	}
+
+	ret = k_futex_wait(&condvar->futex, seq, timeout);
+	atomic_dec(&condvar->waiters);
+
+	(void)sys_mutex_lock(mutex, K_FOREVER);
+
+	/* Signaled before we could sleep */
+	if (ret == -EAGAIN) {
+		ret = 0;
+	}
+
+	return ret;
+}
+
+static int condvar_wake(struct sys_condvar *condvar, bool wake_all)
+{
+	int ret;
+
+	atomic_inc(&condvar->futex.val);
+
+	if (atomic_get(&condvar->waiters) == 0) {
+		return 0;
+	}
+
+	ret = k_futex_wake(&condvar->futex, wake_all);
+
+	return ret < 0 ? ret : 0;
+}
+
+int sys_condvar_signal(struct sys_condvar *condvar)
+{
+	return condvar_wake(condvar, false);
+}
+
+int sys_condvar_broadcast(struct sys_condvar *condvar)
+{
+	return condvar_wake(condvar, true);
+}
@@ -8,6 +8,10 @@
 #include <sys/mutex.h>
 #include <syscall_handler.h>
 #include <kernel_structs.h>
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+#include <ksched.h>
+#include <wait_q.h>
+#endif
 
 static struct k_mutex *get_k_mutex(struct sys_mutex *mutex)
 {
@@ -77,3 +81,117 @@ static inline int z_vrfy_z_sys_mutex_kernel_unlock(struct sys_mutex *mutex)
 	return z_impl_z_sys_mutex_kernel_unlock(mutex);
 }
 #include <syscalls/z_sys_mutex_kernel_unlock_mrsh.c>
+
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+/*
+ * The mutex state lives in user memory and is changed with atomic ops,
+ * like a futex. A sys_mutex is a kernel object itself, so it can't embed a
+ * k_futex; contenders wait on the queue of its underlying k_mutex
+ * instead, which is otherwise unused in this mode.
+ */
+static struct k_spinlock lock;
+
+int z_impl_z_sys_mutex_kernel_wait(struct sys_mutex *mutex, s32_t timeout)
+{
+	struct k_mutex *kernel_mutex = get_k_mutex(mutex);
+	k_spinlock_key_t key;
+	int ret;
+
+	if (kernel_mutex == NULL) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&lock);
+
+	if (atomic_get(&mutex->val) != SYS_MUTEX_CONTENDED) {
+		k_spin_unlock(&lock, key);
+		return -EAGAIN;
+	}
+
+	ret = z_pend_curr(&lock, key, &kernel_mutex->wait_q, timeout);
+	if (ret == -EAGAIN) {
+		ret = -ETIMEDOUT;
+	}
+
+	return ret;
+}
+
+static inline int z_vrfy_z_sys_mutex_kernel_wait(struct sys_mutex *mutex,
+						 s32_t timeout)
+{
+	if (check_sys_mutex_addr((u32_t) mutex)) {
+		return -EACCES;
+	}
+
+	return z_impl_z_sys_mutex_kernel_wait(mutex, timeout);
+}
+#include <syscalls/z_sys_mutex_kernel_wait_mrsh.c>
+
+int z_impl_z_sys_mutex_kernel_wake(struct sys_mutex *mutex)
+{
+	struct k_mutex *kernel_mutex = get_k_mutex(mutex);
+	struct k_thread *thread;
+	k_spinlock_key_t key;
+
+	if (kernel_mutex == NULL) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&lock);
+
+	thread = z_unpend_first_thread(&kernel_mutex->wait_q);
+	if (thread != NULL) {
+		z_ready_thread(thread);
+		arch_thread_return_value_set(thread, 0);
+	}
+
+	z_reschedule(&lock, key);
+
+	return 0;
+}
+
+static inline int z_vrfy_z_sys_mutex_kernel_wake(struct sys_mutex *mutex)
+{
+	if (check_sys_mutex_addr((u32_t) mutex)) {
+		return -EACCES;
+	}
+
+	return z_impl_z_sys_mutex_kernel_wake(mutex);
+}
+#include <syscalls/z_sys_mutex_kernel_wake_mrsh.c>
+
+/* Called from sys_mutex_lock(), in the caller's mode */
+int z_sys_mutex_lock_contended(struct sys_mutex *mutex, s32_t timeout)
+{
+	s64_t end = 0;
+	int ret;
+
+	if (timeout == K_NO_WAIT) {
+		return -EBUSY;
+	}
+
+	if (timeout != K_FOREVER) {
+		end = k_uptime_get() + timeout;
+	}
+
+	/* Whoever gets the mutex from here on does not know whether other
+	 * threads are waiting, so it is left contended and the unlock wakes
+	 * one of them up.
+	 */
+	while (atomic_set(&mutex->val, SYS_MUTEX_CONTENDED) !=
+	       SYS_MUTEX_UNLOCKED) {
+		if (timeout != K_FOREVER) {
+			timeout = MAX(end - k_uptime_get(), 0);
+		}
+
+		ret = z_sys_mutex_kernel_wait(mutex, timeout);
+		if (ret == -ETIMEDOUT) {
+			return -EAGAIN;
+		} else if ((ret != 0) && (ret != -EAGAIN)) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_SYS_MUTEX_FUTEX */
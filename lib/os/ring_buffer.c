@@ -217,3 +217,214 @@ u32_t ring_buf_get(struct ring_buf *buf, u8_t *data, u32_t size)
 
 	return total_size;
 }
+
+/*
+ * Lock-free ring buffer. The head and tail are free-running byte counters,
+ * the offset in the buffer is the counter masked with the buffer size. Each
+ * side only reads the other side's counter with atomic_get() and publishes
+ * its own with atomic_set(), which orders the data accesses against them.
+ */
+
+u32_t ring_buf_lf_put_claim(struct ring_buf_lf *buf, u8_t **data, u32_t size)
+{
+	u32_t tmp_tail = (u32_t)buf->tmp_tail;
+	u32_t space, offset;
+
+	space = buf->mask + 1 - (tmp_tail - (u32_t)atomic_get(&buf->head));
+	offset = tmp_tail & buf->mask;
+
+	/* Limit allocated size to available size and to trail size. */
+	size = MIN(size, space);
+	size = MIN(size, buf->mask + 1 - offset);
+
+	*data = &buf->buf[offset];
+	buf->tmp_tail = (atomic_val_t)(tmp_tail + size);
+
+	return size;
+}
+
+int ring_buf_lf_put_finish(struct ring_buf_lf *buf, u32_t size)
+{
+	u32_t tail = (u32_t)buf->tail;
+
+	if (size > (u32_t)buf->tmp_tail - tail) {
+		return -EINVAL;
+	}
+
+	(void)atomic_set(&buf->tail, (atomic_val_t)(tail + size));
+	buf->tmp_tail = buf->tail;
+
+	return 0;
+}
+
+u32_t ring_buf_lf_put(struct ring_buf_lf *buf, const u8_t *data, u32_t size)
+{
+	u8_t *dst;
+	u32_t partial_size;
+	u32_t total_size = 0U;
+	int err;
+
+	do {
+		partial_size = ring_buf_lf_put_claim(buf, &dst, size);
+		memcpy(dst, data, partial_size);
+		total_size += partial_size;
+		size -= partial_size;
+		data += partial_size;
+	} while (size && partial_size);
+
+	err = ring_buf_lf_put_finish(buf, total_size);
+	__ASSERT_NO_MSG(err == 0);
+
+	return total_size;
+}
+
+/*
+ * Producers claim space by moving tmp_tail with a CAS and count themselves
+ * in writers until they are done writing. The last one to finish publishes
+ * everything claimed so far, reading the claim position only after it left:
+ * any producer that claimed earlier either has finished or is still counted,
+ * in which case it publishes later itself.
+ */
+static u32_t mp_claim(struct ring_buf_lf *buf, u32_t size, bool whole,
+		      u32_t *start)
+{
+	u32_t tmp_tail, space, allocated;
+
+	atomic_inc(&buf->writers);
+
+	do {
+		tmp_tail = (u32_t)atomic_get(&buf->tmp_tail);
+		space = buf->mask + 1 -
+			(tmp_tail - (u32_t)atomic_get(&buf->head));
+
+		if (whole) {
+			allocated = size <= space ? size : 0U;
+		} else {
+			allocated = MIN(size, space);
+			allocated = MIN(allocated, buf->mask + 1 -
+					(tmp_tail & buf->mask));
+		}
+
+		if (allocated == 0U) {
+			ring_buf_lf_mp_put_finish(buf);
+			return 0;
+		}
+	} while (!atomic_cas(&buf->tmp_tail, (atomic_val_t)tmp_tail,
+			     (atomic_val_t)(tmp_tail + allocated)));
+
+	*start = tmp_tail;
+
+	return allocated;
+}
+
+u32_t ring_buf_lf_mp_put_claim(struct ring_buf_lf *buf, u8_t **data,
+			       u32_t size)
+{
+	u32_t start = 0U;
+	u32_t allocated;
+
+	allocated = mp_claim(buf, size, false, &start);
+	*data = &buf->buf[start & buf->mask];
+
+	return allocated;
+}
+
+void ring_buf_lf_mp_put_finish(struct ring_buf_lf *buf)
+{
+	u32_t tmp_tail, tail;
+
+	if (atomic_dec(&buf->writers) != 1) {
+		return;
+	}
+
+	/* Claims made before leaving are only covered by a claim position
+	 * read afterwards. If a new producer got counted meanwhile, the
+	 * position may include its unwritten bytes and it publishes instead.
+	 */
+	tmp_tail = (u32_t)atomic_get(&buf->tmp_tail);
+	if (atomic_get(&buf->writers) != 0) {
+		return;
+	}
+
+	/* The tail never moves backwards if a later producer was faster */
+	do {
+		tail = (u32_t)atomic_get(&buf->tail);
+		if ((s32_t)(tmp_tail - tail) <= 0) {
+			return;
+		}
+	} while (!atomic_cas(&buf->tail, (atomic_val_t)tail,
+			     (atomic_val_t)tmp_tail));
+}
+
+u32_t ring_buf_lf_mp_put(struct ring_buf_lf *buf, const u8_t *data,
+			 u32_t size)
+{
+	u32_t start = 0U;
+	u32_t offset, trail_size;
+
+	if (mp_claim(buf, size, true, &start) == 0U) {
+		return 0;
+	}
+
+	offset = start & buf->mask;
+	trail_size = MIN(size, buf->mask + 1 - offset);
+	memcpy(&buf->buf[offset], data, trail_size);
+	memcpy(buf->buf, data + trail_size, size - trail_size);
+
+	ring_buf_lf_mp_put_finish(buf);
+
+	return size;
+}
+
+u32_t ring_buf_lf_get_claim(struct ring_buf_lf *buf, u8_t **data,
+			    u32_t size)
+{
+	u32_t avail, offset;
+
+	avail = (u32_t)atomic_get(&buf->tail) - buf->tmp_head;
+	offset = buf->tmp_head & buf->mask;
+
+	/* Limit granted size to available size and to trail size. */
+	size = MIN(size, avail);
+	size = MIN(size, buf->mask + 1 - offset);
+
+	*data = &buf->buf[offset];
+	buf->tmp_head += size;
+
+	return size;
+}
+
+int ring_buf_lf_get_finish(struct ring_buf_lf *buf, u32_t size)
+{
+	u32_t head = (u32_t)buf->head;
+
+	if (size > buf->tmp_head - head) {
+		return -EINVAL;
+	}
+
+	(void)atomic_set(&buf->head, (atomic_val_t)(head + size));
+	buf->tmp_head = head + size;
+
+	return 0;
+}
+
+u32_t ring_buf_lf_get(struct ring_buf_lf *buf, u8_t *data, u32_t size)
+{
+	u8_t *src;
+	u32_t partial_size;
+	u32_t total_size = 0U;
+	int err;
+
+	do {
+		partial_size = ring_buf_lf_get_claim(buf, &src, size);
+		memcpy(data, src, partial_size);
+		total_size += partial_size;
+		size -= partial_size;
+		data += partial_size;
+	} while (size && partial_size);
+
+	err = ring_buf_lf_get_finish(buf, total_size);
+	__ASSERT_NO_MSG(err == 0);
+
+	return total_size;
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <sys/rwlock.h>
+
+/*
+ * The futex value holds the number of readers, or the writer flag, plus a
+ * flag telling that someone waits and must be woken up once the lock is
+ * free. The waiters flag is only ever set while the lock is held.
+ */
+#define SYS_RWLOCK_WRITER	BIT(30)
+#define SYS_RWLOCK_WAITERS	BIT(29)
+#define SYS_RWLOCK_READERS	(SYS_RWLOCK_WAITERS - 1)
+
+static int rwlock_lock(struct sys_rwlock *rwlock, bool write, s32_t timeout)
+{
+	atomic_t *val = &rwlock->futex.val;
+	atomic_val_t state, new_state;
+	s64_t end = 0;
+	bool free;
+	int ret;
+
+	if ((timeout != K_FOREVER) && (timeout != K_NO_WAIT)) {
+		end = k_uptime_get() + timeout;
+	}
+
+	while (true) {
+		state = atomic_get(val);
+
+		if (write) {
+			free = !(state & (SYS_RWLOCK_WRITER |
+					  SYS_RWLOCK_READERS));
+		} else {
+			free = !(state & SYS_RWLOCK_WRITER);
+		}
+
+		if (free) {
+			new_state = write ? (state | SYS_RWLOCK_WRITER) :
+					    state + 1;
+			if (atomic_cas(val, state, new_state)) {
+				return 0;
+			}
+
+			continue;
+		}
+
+		if (timeout == K_NO_WAIT) {
+			return -ETIMEDOUT;
+		}
+
+		if (!(state & SYS_RWLOCK_WAITERS)) {
+			if (!atomic_cas(val, state,
+					state | SYS_RWLOCK_WAITERS)) {
+				continue;
+			}
+
+			state |= SYS_RWLOCK_WAITERS;
+		}
+
+		if (timeout != K_FOREVER) {
+			timeout = MAX(end - k_uptime_get(), 0);
+		}
+
+		ret = k_futex_wait(&rwlock->futex, state, timeout);
+		if ((ret != 0) && (ret != -EAGAIN)) {
+			return ret;
+		}
+	}
+}
+
+int sys_rwlock_rdlock(struct sys_rwlock *rwlock, s32_t timeout)
+{
+	return rwlock_lock(rwlock, false, timeout);
+}
+
+int sys_rwlock_wrlock(struct sys_rwlock *rwlock, s32_t timeout)
+{
+	return rwlock_lock(rwlock, true, timeout);
+}
+
+int sys_rwlock_unlock(struct sys_rwlock *rwlock)
+{
+	atomic_t *val = &rwlock->futex.val;
+	atomic_val_t state, new_state;
+	int ret;
+
+	do {
+		state = atomic_get(val);
+
+		if (state & SYS_RWLOCK_WRITER) {
+			new_state = 0;
+		} else if (state & SYS_RWLOCK_READERS) {
+			new_state = state - 1;
+			if (!(new_state & SYS_RWLOCK_READERS)) {
+				new_state = 0;
+			}
+		} else {
+			return -EINVAL;
+		}
+	} while (!atomic_cas(val, state, new_state));
+
+	if ((new_state == 0) && (state & SYS_RWLOCK_WAITERS)) {
+		ret = k_futex_wake(&rwlock->futex, true);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
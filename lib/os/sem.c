@@ -9,7 +9,6 @@
 
 #ifdef CONFIG_USERSPACE
 #define SYS_SEM_MINIMUN      0
-#define SYS_SEM_CONTENDED    (SYS_SEM_MINIMUN - 1)
 
 static inline atomic_t bounded_dec(atomic_t *val, atomic_t minimum)
 {
@@ -54,6 +53,7 @@ int sys_sem_init(struct sys_sem *sem, unsigned int initial_count,
 	}
 
 	atomic_set(&sem->futex.val, initial_count);
+	atomic_set(&sem->waiters, 0);
 	sem->limit = limit;
 
 	return 0;
@@ -66,14 +66,17 @@ int sys_sem_give(struct sys_sem *sem)
 
 	old_value = bounded_inc(&sem->futex.val,
 				SYS_SEM_MINIMUN, sem->limit);
-	if (old_value < 0) {
-		ret = k_futex_wake(&sem->futex, true);
+	if (old_value >= sem->limit) {
+		return -EAGAIN;
+	}
+
+	/* Only enter the kernel when a thread may be waiting */
+	if (atomic_get(&sem->waiters) > 0) {
+		ret = k_futex_wake(&sem->futex, false);
 
 		if (ret > 0) {
 			return 0;
 		}
-	} else if (old_value >= sem->limit) {
-		return -EAGAIN;
 	}
 
 	return ret;
@@ -81,20 +84,36 @@ int sys_sem_give(struct sys_sem *sem)
 
 int sys_sem_take(struct sys_sem *sem, s32_t timeout)
 {
-	int ret = 0;
+	int ret;
 	atomic_t old_value;
 
+	old_value = bounded_dec(&sem->futex.val, SYS_SEM_MINIMUN + 1);
+	if (old_value > 0) {
+		return 0;
+	}
+
+	if (timeout == K_NO_WAIT) {
+		return -ETIMEDOUT;
+	}
+
+	/* A give seeing no waiter makes no syscall. The count is raised
+	 * before waiting, and the wait returns at once if a give got in
+	 * between, so no wake up is lost.
+	 */
+	atomic_inc(&sem->waiters);
+
 	do {
-		old_value = bounded_dec(&sem->futex.val,
-					SYS_SEM_MINIMUN);
+		ret = k_futex_wait(&sem->futex, SYS_SEM_MINIMUN, timeout);
+
+		old_value = bounded_dec(&sem->futex.val, SYS_SEM_MINIMUN + 1);
 		if (old_value > 0) {
-			return 0;
+			ret = 0;
+			break;
 		}
-
-		ret = k_futex_wait(&sem->futex,
-				SYS_SEM_CONTENDED, timeout);
 	} while (ret == 0 || ret == -EAGAIN);
 
+	atomic_dec(&sem->waiters);
+
 	return ret;
 }
 
@@ -0,0 +1,234 @@
+/* main.c - Application main entry point */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/types.h>
+#include <stddef.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/printk.h>
+#include <zephyr.h>
+
+#include <bluetooth/bluetooth.h>
+#include <bluetooth/hci.h>
+#include <bluetooth/conn.h>
+#include <bluetooth/l2cap.h>
+
+#define PSM		0x0080
+#define SDU_LEN_MAX	1024
+#define SDU_COUNT	4
+
+/* Reserve room for the HCI, ACL and L2CAP headers plus the SDU length */
+#define SDU_RESERVE	(BT_L2CAP_CHAN_SEND_RESERVE + 2)
+
+#define LOAD_THREAD_STACK_SIZE 256
+
+NET_BUF_POOL_DEFINE(sdu_pool, SDU_COUNT, SDU_RESERVE + SDU_LEN_MAX,
+		    BT_BUF_USER_DATA_MIN, NULL);
+
+static const struct bt_data ad[] = {
+	BT_DATA_BYTES(BT_DATA_FLAGS, (BT_LE_AD_GENERAL | BT_LE_AD_NO_BREDR)),
+};
+
+static K_SEM_DEFINE(chan_connected, 0, 1);
+static atomic_t bytes_sent;
+static u16_t sdu_len;
+
+/* Counter incremented by the lowest priority thread whenever the CPU would
+ * otherwise be idle. Comparing its rate with the one measured before any
+ * Bluetooth traffic gives the CPU load.
+ */
+static volatile u32_t idle_count;
+
+K_THREAD_STACK_DEFINE(load_stack, LOAD_THREAD_STACK_SIZE);
+static struct k_thread load_thread;
+
+static void load_thread_entry(void *p1, void *p2, void *p3)
+{
+	while (1) {
+		idle_count++;
+	}
+}
+
+static void chan_connected_cb(struct bt_l2cap_chan *chan)
+{
+	struct bt_l2cap_le_chan *ch = BT_L2CAP_LE_CHAN(chan);
+
+	sdu_len = MIN(ch->tx.mtu, SDU_LEN_MAX);
+
+	printk("Channel %p connected, tx mtu %u mps %u\n", chan, ch->tx.mtu,
+	       ch->tx.mps);
+
+	k_sem_give(&chan_connected);
+}
+
+static void chan_disconnected_cb(struct bt_l2cap_chan *chan)
+{
+	printk("Channel %p disconnected\n", chan);
+
+	k_sem_reset(&chan_connected);
+}
+
+static void chan_sent_cb(struct bt_l2cap_chan *chan)
+{
+	atomic_add(&bytes_sent, sdu_len);
+}
+
+static int chan_recv_cb(struct bt_l2cap_chan *chan, struct net_buf *buf)
+{
+	return 0;
+}
+
+static struct bt_l2cap_chan_ops chan_ops = {
+	.connected	= chan_connected_cb,
+	.disconnected	= chan_disconnected_cb,
+	.sent		= chan_sent_cb,
+	.recv		= chan_recv_cb,
+};
+
+static struct bt_l2cap_le_chan le_chan = {
+	.chan.ops	= &chan_ops,
+};
+
+static int accept(struct bt_conn *conn, struct bt_l2cap_chan **chan)
+{
+	if (le_chan.chan.conn) {
+		printk("No channels available\n");
+		return -ENOMEM;
+	}
+
+	*chan = &le_chan.chan;
+
+	return 0;
+}
+
+static struct bt_l2cap_server server = {
+	.psm		= PSM,
+	.accept		= accept,
+};
+
+static void connected(struct bt_conn *conn, u8_t err)
+{
+	if (err) {
+		printk("Connection failed (err 0x%02x)\n", err);
+	} else {
+		printk("Connected\n");
+	}
+}
+
+static void disconnected(struct bt_conn *conn, u8_t reason)
+{
+	printk("Disconnected (reason 0x%02x)\n", reason);
+}
+
+static struct bt_conn_cb conn_callbacks = {
+	.connected = connected,
+	.disconnected = disconnected,
+};
+
+static void report(void)
+{
+	static u32_t idle_count_max;
+	static u32_t idle_count_prev;
+	static s64_t stamp;
+	u32_t count;
+	u32_t bytes;
+	u32_t load;
+	s64_t delta;
+
+	delta = k_uptime_delta(&stamp);
+	count = idle_count - idle_count_prev;
+	idle_count_prev += count;
+
+	/* Normalize to one second and calibrate against an unloaded CPU */
+	count = (u64_t)count * MSEC_PER_SEC / MAX(delta, 1);
+	if (count > idle_count_max) {
+		idle_count_max = count;
+	}
+
+	load = 100U - (u64_t)count * 100U / MAX(idle_count_max, 1U);
+	bytes = atomic_set(&bytes_sent, 0);
+
+	printk("%u kbit/s, CPU load %u%%\n",
+	       (u32_t)((u64_t)bytes * 8U / MAX(delta, 1)), load);
+}
+
+static void send_sdus(void)
+{
+	struct net_buf *buf;
+	int err;
+
+	buf = net_buf_alloc(&sdu_pool, K_SECONDS(1));
+	if (!buf) {
+		return;
+	}
+
+	net_buf_reserve(buf, SDU_RESERVE);
+	memset(net_buf_add(buf, sdu_len), 0xaa, sdu_len);
+
+	err = bt_l2cap_chan_send(&le_chan.chan, buf);
+	if (err < 0) {
+		printk("Unable to send (err %d)\n", err);
+		net_buf_unref(buf);
+		k_sleep(K_MSEC(100));
+	}
+}
+
+void main(void)
+{
+	s64_t stamp;
+	int err;
+
+	k_thread_create(&load_thread, load_stack,
+			K_THREAD_STACK_SIZEOF(load_stack), load_thread_entry,
+			NULL, NULL, NULL, K_LOWEST_APPLICATION_THREAD_PRIO, 0,
+			K_NO_WAIT);
+
+	/* Calibrate the CPU load reference before enabling Bluetooth */
+	report();
+	k_sleep(K_SECONDS(1));
+	report();
+
+	err = bt_enable(NULL);
+	if (err) {
+		printk("Bluetooth init failed (err %d)\n", err);
+		return;
+	}
+
+	bt_conn_cb_register(&conn_callbacks);
+
+	err = bt_l2cap_server_register(&server);
+	if (err) {
+		printk("L2CAP server registration failed (err %d)\n", err);
+		return;
+	}
+
+	err = bt_le_adv_start(BT_LE_ADV_CONN_NAME, ad, ARRAY_SIZE(ad), NULL, 0);
+	if (err) {
+		printk("Advertising failed to start (err %d)\n", err);
+		return;
+	}
+
+	printk("Advertising, connect an L2CAP channel to PSM 0x%04x\n", PSM);
+
+	while (1) {
+		k_sem_take(&chan_connected, K_FOREVER);
+		k_sem_give(&chan_connected);
+
+		stamp = k_uptime_get();
+		report();
+
+		while (le_chan.chan.conn) {
+			send_sdus();
+
+			if (k_uptime_get() - stamp >= MSEC_PER_SEC) {
+				stamp = k_uptime_get();
+				report();
+			}
+		}
+	}
+}
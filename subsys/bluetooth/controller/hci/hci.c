@@ -2318,7 +2318,8 @@ int hci_acl_handle(struct net_buf *buf, struct net_buf **evt)
 	len = sys_le16_to_cpu(acl->len);
 	handle = sys_le16_to_cpu(acl->handle);
 
-	if (buf->len < len) {
+	/* The host may pass the data in net_buf fragments */
+	if (net_buf_frags_len(buf) < len) {
 		BT_ERR("Invalid HCI ACL packet length");
 		return -EINVAL;
 	}
@@ -2342,7 +2343,7 @@ int hci_acl_handle(struct net_buf *buf, struct net_buf **evt)
 		pdu_data->ll_id = PDU_DATA_LLID_DATA_CONTINUE;
 	}
 	pdu_data->len = len;
-	memcpy(&pdu_data->lldata[0], buf->data, len);
+	net_buf_linearize(&pdu_data->lldata[0], len, buf, 0, len);
 
 	if (ll_tx_mem_enqueue(handle, node_tx)) {
 		BT_ERR("Invalid Tx Enqueue");
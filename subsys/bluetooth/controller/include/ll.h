@@ -107,6 +107,40 @@ u8_t ll_rx_get(void **node_rx, u16_t *handle);
 void ll_rx_dequeue(void);
 void ll_rx_mem_release(void **node_rx);
 
+/* ISR execution time histograms, indexed by ISR (radio, ticker, ULL high,
+ * ULL low, LLL) or by the role of the radio ISR (none, adv, scan, master,
+ * slave). The getters return an error past the last index.
+ *
+ * Bucket 0 counts durations below 1 us, bucket n (n > 0) those in the range
+ * [2^(n - 1), 2^n) us, and the last bucket everything above.
+ */
+#define LL_PROF_HIST_BUCKETS 12
+
+struct ll_prof_hist {
+	u32_t count;
+	u32_t min;
+	u32_t max;
+	u32_t bucket[LL_PROF_HIST_BUCKETS];
+};
+
+#if defined(CONFIG_BT_CTLR_PROFILE_HIST)
+u8_t ll_prof_hist_isr_get(u8_t isr, struct ll_prof_hist *hist);
+u8_t ll_prof_hist_role_get(u8_t role, struct ll_prof_hist *hist);
+void ll_prof_hist_reset(void);
+#endif /* CONFIG_BT_CTLR_PROFILE_HIST */
+
+/* Scheduled events of the advertiser (role 0), scanner (1), master (2) and
+ * slave (3) roles.
+ */
+struct ll_sched_stats {
+	u32_t events;  /* Events due, including the skipped ones */
+	u32_t skipped; /* Events skipped due to ticker collisions */
+};
+
+#if defined(CONFIG_BT_CTLR_SCHED_STATS)
+u8_t ll_sched_stats_get(u8_t role, struct ll_sched_stats *stats, bool reset);
+#endif /* CONFIG_BT_CTLR_SCHED_STATS */
+
 /* External co-operation */
 void ll_timeslice_ticker_id_get(u8_t * const instance_index, u8_t * const user_id);
 void ll_radio_state_abort(void);
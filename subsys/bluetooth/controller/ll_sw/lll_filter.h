@@ -25,3 +25,4 @@ extern bool ull_filter_lll_rl_addr_allowed(u8_t id_addr_type, u8_t *id_addr,
 extern bool ull_filter_lll_rl_addr_resolve(u8_t id_addr_type, u8_t *id_addr,
 					   u8_t rl_idx);
 extern bool ull_filter_lll_rl_enabled(void);
+extern bool ull_filter_lll_wl_sw_match(u8_t addr_type, u8_t *addr);
@@ -27,12 +27,24 @@
 #include "lll.h"
 #include "lll_vendor.h"
 #include "lll_internal.h"
+#include "lll_prof_internal.h"
 
 #define LOG_MODULE_NAME bt_ctlr_llsw_nordic_lll
 #include "common/log.h"
 
 #include "hal/debug.h"
 
+#if defined(CONFIG_BT_CTLR_PROFILE_HIST)
+#define PROF_HIST_ENTER() u32_t prof_start = lll_prof_hist_enter()
+#define PROF_HIST_EXIT(isr, role) lll_prof_hist_exit((isr), (role), \
+						     prof_start)
+#define PROF_HIST_RESTART() prof_start = lll_prof_hist_enter()
+#else /* !CONFIG_BT_CTLR_PROFILE_HIST */
+#define PROF_HIST_ENTER()
+#define PROF_HIST_EXIT(isr, role)
+#define PROF_HIST_RESTART()
+#endif /* !CONFIG_BT_CTLR_PROFILE_HIST */
+
 #if defined(CONFIG_BT_CTLR_ZLI)
 #define IRQ_CONNECT_FLAGS IRQ_ZERO_LATENCY
 #else
@@ -73,10 +85,20 @@ static void ticker_op_job_disable(u32_t status, void *op_context);
 
 ISR_DIRECT_DECLARE(radio_nrf5_isr)
 {
+#if defined(CONFIG_BT_CTLR_PROFILE_HIST)
+	/* Role of the event this ISR belongs to, a done ISR may prepare the
+	 * next event of a different role.
+	 */
+	u8_t prof_role = lll_prof_hist_role_get();
+#endif /* CONFIG_BT_CTLR_PROFILE_HIST */
+	PROF_HIST_ENTER();
+
 	DEBUG_RADIO_ISR(1);
 
 	isr_radio();
 
+	PROF_HIST_EXIT(LL_PROF_ISR_RADIO, prof_role);
+
 	ISR_DIRECT_PM();
 
 	DEBUG_RADIO_ISR(0);
@@ -85,6 +107,8 @@ ISR_DIRECT_DECLARE(radio_nrf5_isr)
 
 static void rtc0_nrf5_isr(void *arg)
 {
+	PROF_HIST_ENTER();
+
 	DEBUG_TICKER_ISR(1);
 
 	/* On compare0 run ticker worker instance0 */
@@ -92,13 +116,22 @@ static void rtc0_nrf5_isr(void *arg)
 		NRF_RTC0->EVENTS_COMPARE[0] = 0;
 
 		ticker_trigger(0);
+
+		PROF_HIST_EXIT(LL_PROF_ISR_TICKER, LL_PROF_ROLE_NONE);
+		PROF_HIST_RESTART();
 	}
 
 	mayfly_run(TICKER_USER_ID_ULL_HIGH);
 
+	PROF_HIST_EXIT(LL_PROF_ISR_ULL_HIGH, LL_PROF_ROLE_NONE);
+
 #if !defined(CONFIG_BT_CTLR_LOW_LAT) && \
 	(CONFIG_BT_CTLR_ULL_HIGH_PRIO == CONFIG_BT_CTLR_ULL_LOW_PRIO)
+	PROF_HIST_RESTART();
+
 	mayfly_run(TICKER_USER_ID_ULL_LOW);
+
+	PROF_HIST_EXIT(LL_PROF_ISR_ULL_LOW, LL_PROF_ROLE_NONE);
 #endif
 
 	DEBUG_TICKER_ISR(0);
@@ -106,10 +139,14 @@ static void rtc0_nrf5_isr(void *arg)
 
 static void swi_lll_nrf5_isr(void *arg)
 {
+	PROF_HIST_ENTER();
+
 	DEBUG_RADIO_ISR(1);
 
 	mayfly_run(TICKER_USER_ID_LLL);
 
+	PROF_HIST_EXIT(LL_PROF_ISR_LLL, LL_PROF_ROLE_NONE);
+
 	DEBUG_RADIO_ISR(0);
 }
 
@@ -117,10 +154,14 @@ static void swi_lll_nrf5_isr(void *arg)
 	(CONFIG_BT_CTLR_ULL_HIGH_PRIO != CONFIG_BT_CTLR_ULL_LOW_PRIO)
 static void swi_ull_low_nrf5_isr(void *arg)
 {
+	PROF_HIST_ENTER();
+
 	DEBUG_TICKER_JOB(1);
 
 	mayfly_run(TICKER_USER_ID_ULL_LOW);
 
+	PROF_HIST_EXIT(LL_PROF_ISR_ULL_LOW, LL_PROF_ROLE_NONE);
+
 	DEBUG_TICKER_JOB(0);
 }
 #endif
@@ -162,6 +203,10 @@ int lll_init(void)
 	/* Initialize SW IRQ structure */
 	hal_swi_init();
 
+#if defined(CONFIG_BT_CTLR_PROFILE_HIST)
+	lll_prof_hist_init();
+#endif /* CONFIG_BT_CTLR_PROFILE_HIST */
+
 	/* Connect ISRs */
 	IRQ_DIRECT_CONNECT(RADIO_IRQn, CONFIG_BT_CTLR_LLL_PRIO,
 			   radio_nrf5_isr, IRQ_CONNECT_FLAGS);
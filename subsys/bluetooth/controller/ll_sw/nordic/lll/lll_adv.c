@@ -127,6 +127,8 @@ static int prepare_cb(struct lll_prepare_param *prepare_param)
 
 	DEBUG_RADIO_START_A(1);
 
+	lll_prof_hist_role_set(LL_PROF_ROLE_ADV);
+
 	/* Check if stopped (on connection establishment race between LLL and
 	 * ULL.
 	 */
@@ -433,6 +435,17 @@ static void isr_rx(void *param)
 		goto isr_rx_do_close;
 	}
 
+#if defined(CONFIG_BT_CTLR_FILTER_SW)
+	/* Match the whitelist entries not in the hardware filter */
+	if (crc_ok && !devmatch_ok &&
+	    ((struct lll_adv *)param)->filter_policy) {
+		struct pdu_adv *pdu_rx = (void *)radio_pkt_scratch_get();
+
+		devmatch_ok = ull_filter_lll_wl_sw_match(pdu_rx->tx_addr,
+							 pdu_rx->payload);
+	}
+#endif /* CONFIG_BT_CTLR_FILTER_SW */
+
 	if (crc_ok) {
 		int err;
 
@@ -26,6 +26,7 @@
 
 #include "lll_internal.h"
 #include "lll_tim_internal.h"
+#include "lll_prof_internal.h"
 
 #define LOG_MODULE_NAME bt_ctlr_llsw_nordic_lll_master
 #include "common/log.h"
@@ -91,6 +92,8 @@ static int prepare_cb(struct lll_prepare_param *prepare_param)
 
 	DEBUG_RADIO_START_M(1);
 
+	lll_prof_hist_role_set(LL_PROF_ROLE_MASTER);
+
 	/* TODO: Do the below in ULL ?  */
 
 	lazy = prepare_param->lazy;
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr.h>
+#include <soc.h>
+
+#include <bluetooth/hci.h>
+
+#include "util/memq.h"
+
+#include "ll.h"
+
+#include "lll_prof_internal.h"
+
+static struct ll_prof_hist hist_isr[LL_PROF_ISR_COUNT];
+static struct ll_prof_hist hist_role[LL_PROF_ROLE_COUNT];
+static u8_t role_curr;
+
+static inline u32_t timestamp_get(void);
+static inline u32_t timestamp_to_us(u32_t delta);
+static void hist_update(struct ll_prof_hist *hist, u32_t us);
+
+void lll_prof_hist_init(void)
+{
+#if defined(CONFIG_ARMV7_M_ARMV8_M_MAINLINE)
+	/* Free running CPU cycle counter, gives sub-microsecond resolution
+	 * independent of the radio event timer which is only running during
+	 * radio events.
+	 */
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0U;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif /* CONFIG_ARMV7_M_ARMV8_M_MAINLINE */
+
+	ll_prof_hist_reset();
+}
+
+u32_t lll_prof_hist_enter(void)
+{
+	return timestamp_get();
+}
+
+void lll_prof_hist_exit(u8_t isr, u8_t role, u32_t start)
+{
+	u32_t us;
+
+	us = timestamp_to_us(timestamp_get() - start);
+
+	hist_update(&hist_isr[isr], us);
+
+	if (isr == LL_PROF_ISR_RADIO) {
+		hist_update(&hist_role[role], us);
+	}
+}
+
+void lll_prof_hist_role_set(u8_t role)
+{
+	role_curr = role;
+}
+
+u8_t lll_prof_hist_role_get(void)
+{
+	return role_curr;
+}
+
+u8_t ll_prof_hist_isr_get(u8_t isr, struct ll_prof_hist *hist)
+{
+	unsigned int key;
+
+	if (isr >= LL_PROF_ISR_COUNT) {
+		return BT_HCI_ERR_INVALID_PARAM;
+	}
+
+	/* NOTE: Zero latency radio ISR is not masked, a sample may be torn
+	 * across fields which is acceptable for profiling purposes.
+	 */
+	key = irq_lock();
+	*hist = hist_isr[isr];
+	irq_unlock(key);
+
+	return 0;
+}
+
+u8_t ll_prof_hist_role_get(u8_t role, struct ll_prof_hist *hist)
+{
+	unsigned int key;
+
+	if (role >= LL_PROF_ROLE_COUNT) {
+		return BT_HCI_ERR_INVALID_PARAM;
+	}
+
+	key = irq_lock();
+	*hist = hist_role[role];
+	irq_unlock(key);
+
+	return 0;
+}
+
+void ll_prof_hist_reset(void)
+{
+	unsigned int key;
+	u8_t i;
+
+	key = irq_lock();
+
+	(void)memset(hist_isr, 0, sizeof(hist_isr));
+	(void)memset(hist_role, 0, sizeof(hist_role));
+
+	for (i = 0U; i < LL_PROF_ISR_COUNT; i++) {
+		hist_isr[i].min = UINT32_MAX;
+	}
+
+	for (i = 0U; i < LL_PROF_ROLE_COUNT; i++) {
+		hist_role[i].min = UINT32_MAX;
+	}
+
+	irq_unlock(key);
+}
+
+static inline u32_t timestamp_get(void)
+{
+#if defined(CONFIG_ARMV7_M_ARMV8_M_MAINLINE)
+	return DWT->CYCCNT;
+#else /* !CONFIG_ARMV7_M_ARMV8_M_MAINLINE */
+	return k_cycle_get_32();
+#endif /* !CONFIG_ARMV7_M_ARMV8_M_MAINLINE */
+}
+
+static inline u32_t timestamp_to_us(u32_t delta)
+{
+#if defined(CONFIG_ARMV7_M_ARMV8_M_MAINLINE)
+	return delta / (SystemCoreClock / USEC_PER_SEC);
+#else /* !CONFIG_ARMV7_M_ARMV8_M_MAINLINE */
+	/* Resolution is that of the system clock, e.g. 30.5 us on nRF51 */
+	return k_cyc_to_us_floor32(delta);
+#endif /* !CONFIG_ARMV7_M_ARMV8_M_MAINLINE */
+}
+
+static void hist_update(struct ll_prof_hist *hist, u32_t us)
+{
+	u8_t idx;
+
+	if (us) {
+		idx = MIN(32 - __builtin_clz(us), LL_PROF_HIST_BUCKETS - 1);
+	} else {
+		idx = 0U;
+	}
+
+	hist->bucket[idx]++;
+	hist->count++;
+
+	if (us < hist->min) {
+		hist->min = us;
+	}
+
+	if (us > hist->max) {
+		hist->max = us;
+	}
+}
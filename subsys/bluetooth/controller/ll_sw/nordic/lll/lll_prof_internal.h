@@ -8,3 +8,37 @@ void lll_prof_latency_capture(void);
 void lll_prof_radio_end_backup(void);
 void lll_prof_cputime_capture(void);
 void lll_prof_send(void);
+
+/* ISR execution time histograms */
+enum {
+	LL_PROF_ISR_RADIO,
+	LL_PROF_ISR_TICKER,
+	LL_PROF_ISR_ULL_HIGH,
+	LL_PROF_ISR_ULL_LOW,
+	LL_PROF_ISR_LLL,
+
+	LL_PROF_ISR_COUNT,
+};
+
+enum {
+	LL_PROF_ROLE_NONE,
+	LL_PROF_ROLE_ADV,
+	LL_PROF_ROLE_SCAN,
+	LL_PROF_ROLE_MASTER,
+	LL_PROF_ROLE_SLAVE,
+
+	LL_PROF_ROLE_COUNT,
+};
+
+#if defined(CONFIG_BT_CTLR_PROFILE_HIST)
+void lll_prof_hist_init(void);
+u32_t lll_prof_hist_enter(void);
+void lll_prof_hist_exit(u8_t isr, u8_t role, u32_t start);
+void lll_prof_hist_role_set(u8_t role);
+u8_t lll_prof_hist_role_get(void);
+#else /* !CONFIG_BT_CTLR_PROFILE_HIST */
+static inline void lll_prof_hist_role_set(u8_t role)
+{
+	ARG_UNUSED(role);
+}
+#endif /* !CONFIG_BT_CTLR_PROFILE_HIST */
@@ -72,6 +72,12 @@ static inline bool isr_scan_rsp_adva_matches(struct pdu_adv *srsp);
 static u32_t isr_rx_scan_report(struct lll_scan *lll, u8_t rssi_ready,
 				u8_t rl_idx, bool dir_report);
 
+#if defined(CONFIG_BT_CTLR_FILTER_SW) && defined(CONFIG_BT_CTLR_PROFILE_ISR)
+/* Profile one in this many PDUs rejected by the whitelist */
+#define PROF_REJECT_SAMPLE 32
+
+static u8_t prof_reject_count;
+#endif /* CONFIG_BT_CTLR_FILTER_SW && CONFIG_BT_CTLR_PROFILE_ISR */
 
 int lll_scan_init(void)
 {
@@ -126,6 +132,8 @@ static int prepare_cb(struct lll_prepare_param *prepare_param)
 
 	DEBUG_RADIO_START_O(1);
 
+	lll_prof_hist_role_set(LL_PROF_ROLE_SCAN);
+
 	/* Check if stopped (on connection establishment race between LLL and
 	 * ULL.
 	 */
@@ -386,6 +394,17 @@ static void isr_rx(void *param)
 		goto isr_rx_do_close;
 	}
 
+#if defined(CONFIG_BT_CTLR_FILTER_SW)
+	/* Match the whitelist entries not in the hardware filter */
+	if (crc_ok && !devmatch_ok && (lll->filter_policy & 0x01)) {
+		struct node_rx_pdu *node_rx = ull_pdu_rx_alloc_peek(1);
+		struct pdu_adv *pdu_adv_rx = (void *)node_rx->pdu;
+
+		devmatch_ok = ull_filter_lll_wl_sw_match(pdu_adv_rx->tx_addr,
+							 pdu_adv_rx->payload);
+	}
+#endif /* CONFIG_BT_CTLR_FILTER_SW */
+
 #if defined(CONFIG_BT_CTLR_PRIVACY)
 	rl_idx = devmatch_ok ?
 		 ull_filter_lll_rl_idx(!!(lll->filter_policy & 0x01),
@@ -409,6 +428,15 @@ static void isr_rx(void *param)
 			return;
 		}
 	}
+#if defined(CONFIG_BT_CTLR_FILTER_SW) && defined(CONFIG_BT_CTLR_PROFILE_ISR)
+	else if (!(++prof_reject_count % PROF_REJECT_SAMPLE)) {
+		/* Also profile a sample of the PDUs rejected by the
+		 * whitelist, without adding work to every one of them.
+		 */
+		lll_prof_cputime_capture();
+		lll_prof_send();
+	}
+#endif /* CONFIG_BT_CTLR_FILTER_SW && CONFIG_BT_CTLR_PROFILE_ISR */
 
 isr_rx_do_close:
 	radio_isr_set(isr_done, lll);
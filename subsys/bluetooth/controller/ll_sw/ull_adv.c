@@ -41,6 +41,7 @@
 #include "ull_scan_internal.h"
 #include "ull_conn_internal.h"
 #include "ull_internal.h"
+#include "ull_sched_internal.h"
 
 #define LOG_MODULE_NAME bt_ctlr_llsw_ull_adv
 #include "common/log.h"
@@ -815,6 +816,30 @@ u8_t ll_adv_enable(u8_t enable)
 	}
 #endif /* !CONFIG_BT_HCI_MESH_EXT */
 
+#if defined(CONFIG_BT_CTLR_SCHED_ADV_GAP)
+#if defined(CONFIG_BT_HCI_MESH_EXT)
+	if (!at_anchor)
+#endif /* CONFIG_BT_HCI_MESH_EXT */
+	{
+		u32_t ticks_ref = 0U;
+		u32_t offset_us = 0U;
+
+		ull_sched_free_slot_get(TICKER_USER_ID_THREAD,
+					(ticks_slot_offset +
+					 adv->evt.ticks_slot),
+					&ticks_ref, &offset_us);
+
+		/* Use the ticks_ref as advertiser's anchor if a free time
+		 * space after the other active roles is available (indicated
+		 * by a non-zero offset_us value).
+		 */
+		if (offset_us) {
+			ticks_anchor = ticks_ref +
+				       HAL_TICKER_US_TO_TICKS(offset_us);
+		}
+	}
+#endif /* CONFIG_BT_CTLR_SCHED_ADV_GAP */
+
 	/* High Duty Cycle Directed Advertising if interval is 0. */
 #if defined(CONFIG_BT_PERIPHERAL)
 	lll->is_hdcd = !interval && (pdu_adv->type == PDU_ADV_TYPE_DIRECT_IND);
@@ -1018,6 +1043,9 @@ static void ticker_cb(u32_t ticks_at_expire, u32_t remainder, u16_t lazy,
 
 	if (IS_ENABLED(CONFIG_BT_TICKER_COMPATIBILITY_MODE) ||
 	    (lazy != TICKER_LAZY_MUST_EXPIRE)) {
+		/* Account scheduled and skipped events */
+		ull_sched_stats_evt(ULL_SCHED_ROLE_ADV, lazy, 0U);
+
 		/* Increment prepare reference count */
 		ref = ull_ref_inc(&adv->ull);
 		LL_ASSERT(ref);
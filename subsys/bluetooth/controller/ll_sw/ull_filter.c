@@ -44,6 +44,28 @@
 static struct lll_filter wl_filter;
 u8_t wl_anon;
 
+#if defined(CONFIG_BT_CTLR_FILTER_SW)
+/* Software whitelist, holding all the entries including the ones that do
+ * not fit in the hardware filter. A bloom filter rejects most of the
+ * non-matching addresses with two bit tests, an open addressing hash table
+ * confirms the matches.
+ */
+#define WL_SW_SLOTS       (CONFIG_BT_CTLR_FILTER_SW_SIZE * 2)
+#define WL_SW_BLOOM_BITS  (CONFIG_BT_CTLR_FILTER_SW_SIZE * 8)
+#define WL_SW_BLOOM_WORDS ((WL_SW_BLOOM_BITS + 31) / 32)
+
+static struct {
+	u8_t taken:1;
+	u8_t hw:1;
+	u8_t addr_type:1;
+	u8_t addr[BDADDR_SIZE];
+} wl_sw[WL_SW_SLOTS];
+
+static u32_t wl_sw_bloom[WL_SW_BLOOM_WORDS];
+static u8_t wl_sw_count;
+static u8_t wl_sw_hw_count;
+#endif /* CONFIG_BT_CTLR_FILTER_SW */
+
 #if defined(CONFIG_BT_CTLR_PRIVACY)
 #include "common/rpa.h"
 
@@ -119,6 +141,16 @@ static u32_t filter_add(struct lll_filter *filter, u8_t addr_type,
 			u8_t *bdaddr);
 static u32_t filter_remove(struct lll_filter *filter, u8_t addr_type,
 			   u8_t *bdaddr);
+
+#if defined(CONFIG_BT_CTLR_FILTER_SW)
+static u32_t wl_sw_hash(u8_t addr_type, const u8_t *addr);
+static u8_t wl_sw_find(u8_t addr_type, const u8_t *addr, u32_t hash,
+		       u8_t *free);
+static void wl_sw_bloom_set(u32_t hash);
+static u32_t wl_sw_add(u8_t addr_type, u8_t *addr);
+static u32_t wl_sw_remove(u8_t addr_type, u8_t *addr);
+static void wl_sw_clear(void);
+#endif /* CONFIG_BT_CTLR_FILTER_SW */
 #endif /* !CONFIG_BT_CTLR_PRIVACY */
 
 static void filter_insert(struct lll_filter *filter, int index, u8_t addr_type,
@@ -127,7 +159,11 @@ static void filter_clear(struct lll_filter *filter);
 
 u8_t ll_wl_size_get(void)
 {
+#if defined(CONFIG_BT_CTLR_FILTER_SW)
+	return CONFIG_BT_CTLR_FILTER_SW_SIZE;
+#else /* !CONFIG_BT_CTLR_FILTER_SW */
 	return WL_SIZE;
+#endif /* !CONFIG_BT_CTLR_FILTER_SW */
 }
 
 u8_t ll_wl_clear(void)
@@ -146,6 +182,8 @@ u8_t ll_wl_clear(void)
 
 #if defined(CONFIG_BT_CTLR_PRIVACY)
 	wl_clear();
+#elif defined(CONFIG_BT_CTLR_FILTER_SW)
+	wl_sw_clear();
 #else
 	filter_clear(&wl_filter);
 #endif /* CONFIG_BT_CTLR_PRIVACY */
@@ -176,6 +214,8 @@ u8_t ll_wl_add(bt_addr_le_t *addr)
 
 #if defined(CONFIG_BT_CTLR_PRIVACY)
 	return wl_add(addr);
+#elif defined(CONFIG_BT_CTLR_FILTER_SW)
+	return wl_sw_add(addr->type, addr->a.val);
 #else
 	return filter_add(&wl_filter, addr->type, addr->a.val);
 #endif /* CONFIG_BT_CTLR_PRIVACY */
@@ -202,6 +242,8 @@ u8_t ll_wl_remove(bt_addr_le_t *addr)
 
 #if defined(CONFIG_BT_CTLR_PRIVACY)
 	return wl_remove(addr);
+#elif defined(CONFIG_BT_CTLR_FILTER_SW)
+	return wl_sw_remove(addr->type, addr->a.val);
 #else
 	return filter_remove(&wl_filter, addr->type, addr->a.val);
 #endif /* CONFIG_BT_CTLR_PRIVACY */
@@ -608,6 +650,8 @@ void ull_filter_reset(bool init)
 	} else {
 		k_delayed_work_cancel(&rpa_work);
 	}
+#elif defined(CONFIG_BT_CTLR_FILTER_SW)
+	wl_sw_clear();
 #else
 	filter_clear(&wl_filter);
 #endif /* CONFIG_BT_CTLR_PRIVACY */
@@ -684,6 +728,33 @@ struct lll_filter *ull_filter_lll_get(bool whitelist)
 #endif
 }
 
+#if defined(CONFIG_BT_CTLR_FILTER_SW)
+bool ull_filter_lll_wl_sw_match(u8_t addr_type, u8_t *addr)
+{
+	u32_t hash;
+	u16_t bit;
+
+	/* All entries are in the hardware filter, nothing more to match */
+	if (wl_sw_count == wl_sw_hw_count) {
+		return false;
+	}
+
+	hash = wl_sw_hash(addr_type, addr);
+
+	bit = hash % WL_SW_BLOOM_BITS;
+	if (!(wl_sw_bloom[bit >> 5] & BIT(bit & 0x1f))) {
+		return false;
+	}
+
+	bit = (hash >> 16) % WL_SW_BLOOM_BITS;
+	if (!(wl_sw_bloom[bit >> 5] & BIT(bit & 0x1f))) {
+		return false;
+	}
+
+	return wl_sw_find(addr_type, addr, hash, NULL) < WL_SW_SLOTS;
+}
+#endif /* CONFIG_BT_CTLR_FILTER_SW */
+
 #if defined(CONFIG_BT_CTLR_PRIVACY)
 bool ull_filter_lll_rl_idx_allowed(u8_t irkmatch_ok, u8_t rl_idx)
 {
@@ -981,6 +1052,160 @@ static u32_t filter_remove(struct lll_filter *filter, u8_t addr_type,
 
 	return BT_HCI_ERR_INVALID_PARAM;
 }
+
+#if defined(CONFIG_BT_CTLR_FILTER_SW)
+static u32_t wl_sw_hash(u8_t addr_type, const u8_t *addr)
+{
+	/* FNV-1a over the address type and the address */
+	u32_t hash = (2166136261UL ^ (addr_type & 0x01)) * 16777619UL;
+	u8_t i;
+
+	for (i = 0U; i < BDADDR_SIZE; i++) {
+		hash = (hash ^ addr[i]) * 16777619UL;
+	}
+
+	return hash;
+}
+
+static u8_t wl_sw_find(u8_t addr_type, const u8_t *addr, u32_t hash,
+		       u8_t *free)
+{
+	u8_t i, n;
+
+	if (free) {
+		*free = FILTER_IDX_NONE;
+	}
+
+	i = hash % WL_SW_SLOTS;
+	for (n = 0U; n < WL_SW_SLOTS; n++) {
+		if (wl_sw[i].taken) {
+			if ((wl_sw[i].addr_type == (addr_type & 0x01)) &&
+			    !memcmp(wl_sw[i].addr, addr, BDADDR_SIZE)) {
+				return i;
+			}
+		} else {
+			/* End of the probe sequence, removals leave no gaps */
+			if (free) {
+				*free = i;
+			}
+
+			break;
+		}
+
+		i = (i + 1U) % WL_SW_SLOTS;
+	}
+
+	return FILTER_IDX_NONE;
+}
+
+static void wl_sw_bloom_set(u32_t hash)
+{
+	u16_t bit;
+
+	bit = hash % WL_SW_BLOOM_BITS;
+	wl_sw_bloom[bit >> 5] |= BIT(bit & 0x1f);
+
+	bit = (hash >> 16) % WL_SW_BLOOM_BITS;
+	wl_sw_bloom[bit >> 5] |= BIT(bit & 0x1f);
+}
+
+static u32_t wl_sw_add(u8_t addr_type, u8_t *addr)
+{
+	u32_t hash = wl_sw_hash(addr_type, addr);
+	u8_t i, j;
+
+	i = wl_sw_find(addr_type, addr, hash, &j);
+	if (i < WL_SW_SLOTS) {
+		return 0;
+	} else if ((wl_sw_count >= CONFIG_BT_CTLR_FILTER_SW_SIZE) ||
+		   (j >= WL_SW_SLOTS)) {
+		return BT_HCI_ERR_MEM_CAPACITY_EXCEEDED;
+	}
+
+	wl_sw[j].addr_type = addr_type & 0x01;
+	memcpy(wl_sw[j].addr, addr, BDADDR_SIZE);
+	wl_sw[j].taken = 1U;
+	wl_sw_count++;
+
+	wl_sw_bloom_set(hash);
+
+	/* Use the hardware filter while it has room */
+	wl_sw[j].hw = !filter_add(&wl_filter, addr_type, addr);
+	wl_sw_hw_count += wl_sw[j].hw;
+
+	return 0;
+}
+
+static u32_t wl_sw_remove(u8_t addr_type, u8_t *addr)
+{
+	u8_t home;
+	u8_t i, j;
+
+	i = wl_sw_find(addr_type, addr, wl_sw_hash(addr_type, addr), NULL);
+	if (i >= WL_SW_SLOTS) {
+		return BT_HCI_ERR_INVALID_PARAM;
+	}
+
+	wl_sw_count--;
+
+	if (wl_sw[i].hw) {
+		filter_remove(&wl_filter, addr_type, addr);
+		wl_sw_hw_count--;
+	}
+
+	/* Rehash the rest of the probe sequence instead of leaving a
+	 * tombstone: move back each following entry whose home slot is not
+	 * cyclically in (i, j], so that lookups still stop at the first free
+	 * slot however many entries have been removed.
+	 */
+	for (j = (i + 1U) % WL_SW_SLOTS; wl_sw[j].taken;
+	     j = (j + 1U) % WL_SW_SLOTS) {
+		home = wl_sw_hash(wl_sw[j].addr_type, wl_sw[j].addr) %
+		       WL_SW_SLOTS;
+
+		if ((i < j) ? ((home <= i) || (home > j)) :
+			      ((home <= i) && (home > j))) {
+			wl_sw[i] = wl_sw[j];
+			i = j;
+		}
+	}
+
+	wl_sw[i].taken = 0U;
+	wl_sw[i].hw = 0U;
+
+	/* Bloom filters do not support removal, rebuild it and refill the
+	 * hardware filter with entries that so far only were in software.
+	 */
+	(void)memset(wl_sw_bloom, 0, sizeof(wl_sw_bloom));
+	for (i = 0U; i < WL_SW_SLOTS; i++) {
+		if (!wl_sw[i].taken) {
+			continue;
+		}
+
+		wl_sw_bloom_set(wl_sw_hash(wl_sw[i].addr_type,
+					   wl_sw[i].addr));
+
+		if (!wl_sw[i].hw && (wl_sw_hw_count < WL_SIZE)) {
+			filter_add(&wl_filter, wl_sw[i].addr_type,
+				   wl_sw[i].addr);
+			wl_sw[i].hw = 1U;
+			wl_sw_hw_count++;
+		}
+	}
+
+	return 0;
+}
+
+static void wl_sw_clear(void)
+{
+	(void)memset(wl_sw, 0, sizeof(wl_sw));
+	(void)memset(wl_sw_bloom, 0, sizeof(wl_sw_bloom));
+	wl_sw_count = 0U;
+	wl_sw_hw_count = 0U;
+
+	filter_clear(&wl_filter);
+}
+#endif /* CONFIG_BT_CTLR_FILTER_SW */
 #endif /* !CONFIG_BT_CTLR_PRIVACY */
 
 static void filter_insert(struct lll_filter *filter, int index, u8_t addr_type,
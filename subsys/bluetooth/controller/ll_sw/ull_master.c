@@ -14,6 +14,7 @@
 
 #include "hal/ticker.h"
 #include "hal/ccm.h"
+#include "hal/radio.h"
 #include "ticker/ticker.h"
 
 #include "pdu.h"
@@ -38,6 +39,7 @@
 #include "ull_internal.h"
 #include "ull_scan_internal.h"
 #include "ull_conn_internal.h"
+#include "ull_sched_internal.h"
 #include "ull_master_internal.h"
 
 #define LOG_MODULE_NAME bt_ctlr_llsw_ull_master
@@ -90,7 +92,15 @@ u8_t ll_create_connection(u16_t scan_interval, u16_t scan_window,
 	lll->adv_addr_type = peer_addr_type;
 	memcpy(lll->adv_addr, peer_addr, BDADDR_SIZE);
 	lll->conn_timeout = timeout;
-	lll->conn_ticks_slot = 0; /* TODO: */
+	/* Estimate the first connection event slot, used to place it after
+	 * the active master roles. Connections are established on the 1M PHY.
+	 */
+	lll->conn_ticks_slot =
+		HAL_TICKER_US_TO_TICKS(EVENT_OVERHEAD_START_US +
+				       radio_tx_ready_delay_get(BIT(0), 0) +
+				       PKT_US(PDU_DC_PAYLOAD_SIZE_MIN, BIT(0)) +
+				       EVENT_IFS_US +
+				       PKT_US(PDU_DC_PAYLOAD_SIZE_MIN, BIT(0)));
 
 	conn_lll = &conn->lll;
 
@@ -618,6 +628,12 @@ void ull_master_ticker_cb(u32_t ticks_at_expire, u32_t remainder, u16_t lazy,
 		return;
 	}
 
+	/* Account scheduled and skipped events, skips due to latency are
+	 * not collisions.
+	 */
+	ull_sched_stats_evt(ULL_SCHED_ROLE_MASTER, lazy,
+			    conn->lll.latency_event);
+
 	/* Increment prepare reference count */
 	ref = ull_ref_inc(&conn->ull);
 	LL_ASSERT(ref);
@@ -381,6 +381,9 @@ static void ticker_cb(u32_t ticks_at_expire, u32_t remainder, u16_t lazy,
 
 	DEBUG_RADIO_PREPARE_O(1);
 
+	/* Account scheduled and skipped events */
+	ull_sched_stats_evt(ULL_SCHED_ROLE_SCAN, lazy, 0U);
+
 	/* Increment prepare reference count */
 	ref = ull_ref_inc(&scan->ull);
 	LL_ASSERT(ref);
@@ -408,6 +411,7 @@ static void ticker_cb(u32_t ticks_at_expire, u32_t remainder, u16_t lazy,
 			ull_sched_mfy_after_mstr_offset_get};
 		u32_t retval;
 
+		scan->ticks_anchor = ticks_at_expire;
 		s_mfy_sched_after_mstr_offset_get.param = (void *)scan;
 
 		retval = mayfly_enqueue(TICKER_USER_ID_ULL_HIGH,
@@ -11,4 +11,11 @@ struct ll_scan_set {
 
 	u8_t is_enabled:1;
 	u8_t own_addr_type:2;
+
+#if defined(CONFIG_BT_CENTRAL) && defined(CONFIG_BT_CTLR_SCHED_ADVANCED)
+	/* Anchor of the current scan event, used to place the first
+	 * connection event after the active master roles.
+	 */
+	u32_t ticks_anchor;
+#endif /* CONFIG_BT_CENTRAL && CONFIG_BT_CTLR_SCHED_ADVANCED */
 };
@@ -4,31 +4,108 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
-#include <zephyr/types.h>
-#include <toolchain.h>
+#include <string.h>
+#include <stdbool.h>
 
+#include <zephyr.h>
+#include <bluetooth/hci.h>
+
+#include "hal/ccm.h"
+#include "hal/ticker.h"
+
+#include "util/util.h"
 #include "util/memq.h"
+#include "util/mayfly.h"
+
+#include "ticker/ticker.h"
 
 #include "pdu.h"
 
+#include "ll.h"
 #include "lll.h"
+#include "lll_vendor.h"
+#include "lll_adv.h"
 #include "lll_scan.h"
+#include "lll_conn.h"
 
+#include "ull_adv_types.h"
 #include "ull_scan_types.h"
+#include "ull_conn_types.h"
+
+#include "ull_adv_internal.h"
+#include "ull_scan_internal.h"
+#include "ull_conn_internal.h"
+#include "ull_sched_internal.h"
+
+#define LOG_MODULE_NAME bt_ctlr_llsw_ull_sched
+#include "common/log.h"
+#include <soc.h>
+#include "hal/debug.h"
+
+#if defined(CONFIG_BT_CTLR_SCHED_ADVANCED)
+/* Role filter used when walking the ticker nodes in search of free time
+ * space.
+ */
+#define SCHED_FILTER_MSTR BIT(0) /* master role connections only */
+#define SCHED_FILTER_ALL  BIT(1) /* all roles reserving a time slot */
+
+static void ticker_op_cb(u32_t status, void *param);
+static struct evt_hdr *evt_hdr_get(u8_t ticker_id, u8_t filter);
+static void free_slot_get(u8_t user_id, u8_t filter, u32_t ticks_slot_abs,
+			  u32_t *ticks_anchor, u32_t *us_offset);
+#if defined(CONFIG_BT_CENTRAL)
+static void after_mstr_offset_get(u16_t conn_interval, u32_t ticks_slot,
+				  u32_t ticks_anchor, u32_t *win_offset_us);
+#endif /* CONFIG_BT_CENTRAL */
+#endif /* CONFIG_BT_CTLR_SCHED_ADVANCED */
+
+#if defined(CONFIG_BT_CTLR_SCHED_STATS)
+struct stats_get_param {
+	struct k_sem sem;
+	struct ll_sched_stats *out;
+	u8_t role;
+	bool reset;
+};
+
+static void stats_get(void *param);
 
+static struct ll_sched_stats stats[ULL_SCHED_ROLE_COUNT];
+#endif /* CONFIG_BT_CTLR_SCHED_STATS */
+
+#if defined(CONFIG_BT_CTLR_SCHED_ADVANCED)
 void ull_sched_after_mstr_slot_get(u8_t user_id, u32_t ticks_slot_abs,
 				   u32_t *ticks_anchor, u32_t *us_offset)
 {
-	/* TODO: */
+	free_slot_get(user_id, SCHED_FILTER_MSTR, ticks_slot_abs,
+		      ticks_anchor, us_offset);
+}
+
+void ull_sched_free_slot_get(u8_t user_id, u32_t ticks_slot_abs,
+			     u32_t *ticks_anchor, u32_t *us_offset)
+{
+	free_slot_get(user_id, SCHED_FILTER_ALL, ticks_slot_abs,
+		      ticks_anchor, us_offset);
 }
 
+#if defined(CONFIG_BT_CENTRAL)
 void ull_sched_mfy_after_mstr_offset_get(void *param)
 {
 	struct ll_scan_set *scan = param;
+	struct lll_conn *conn_lll;
 
-	/* TODO: */
-	scan->lll.conn_win_offset_us = 0;
+	conn_lll = scan->lll.conn;
+	if (!conn_lll) {
+		scan->lll.conn_win_offset_us = 0U;
+
+		return;
+	}
+
+	after_mstr_offset_get(conn_lll->interval,
+			      scan->lll.conn_ticks_slot,
+			      scan->ticks_anchor,
+			      &scan->lll.conn_win_offset_us);
 }
+#endif /* CONFIG_BT_CENTRAL */
 
 void ull_sched_mfy_free_win_offset_calc(void *param)
 {
@@ -44,3 +121,255 @@ void ull_sched_mfy_win_offset_select(void *param)
 {
 	/* TODO: */
 }
+#endif /* CONFIG_BT_CTLR_SCHED_ADVANCED */
+
+#if defined(CONFIG_BT_CTLR_SCHED_STATS)
+u8_t ll_sched_stats_get(u8_t role, struct ll_sched_stats *out, bool reset)
+{
+	static memq_link_t link;
+	static struct mayfly mfy = {0, 0, &link, NULL, stats_get};
+	struct stats_get_param param;
+	u32_t ret;
+
+	if (role >= ULL_SCHED_ROLE_COUNT) {
+		return BT_HCI_ERR_INVALID_PARAM;
+	}
+
+	/* The counters are updated in the ticker callbacks, read and reset
+	 * them in the same ULL_HIGH context so that no event is lost.
+	 */
+	k_sem_init(&param.sem, 0, 1);
+	param.out = out;
+	param.role = role;
+	param.reset = reset;
+
+	mfy.param = &param;
+	ret = mayfly_enqueue(TICKER_USER_ID_THREAD, TICKER_USER_ID_ULL_HIGH, 0,
+			     &mfy);
+	LL_ASSERT(!ret);
+
+	k_sem_take(&param.sem, K_FOREVER);
+
+	return 0;
+}
+
+void ull_sched_stats_evt(u8_t role, u16_t lazy, u16_t lazy_expected)
+{
+	struct ll_sched_stats *s;
+
+	LL_ASSERT(role < ULL_SCHED_ROLE_COUNT);
+
+	s = &stats[role];
+
+	/* One event is being prepared in this expiry, lazy ones were
+	 * skipped by the ticker since the previous expiry. Laziness
+	 * requested by the role itself (e.g. slave latency) is not a drop.
+	 */
+	s->events++;
+	if (lazy > lazy_expected) {
+		s->events += lazy - lazy_expected;
+		s->skipped += lazy - lazy_expected;
+	}
+}
+#endif /* CONFIG_BT_CTLR_SCHED_STATS */
+
+#if defined(CONFIG_BT_CTLR_SCHED_STATS)
+static void stats_get(void *param)
+{
+	struct stats_get_param *p = param;
+
+	*p->out = stats[p->role];
+
+	if (p->reset) {
+		(void)memset(&stats[p->role], 0, sizeof(stats[p->role]));
+	}
+
+	k_sem_give(&p->sem);
+}
+#endif /* CONFIG_BT_CTLR_SCHED_STATS */
+
+#if defined(CONFIG_BT_CTLR_SCHED_ADVANCED)
+static void ticker_op_cb(u32_t status, void *param)
+{
+	*((u32_t volatile *)param) = status;
+}
+
+static struct evt_hdr *evt_hdr_get(u8_t ticker_id, u8_t filter)
+{
+#if defined(CONFIG_BT_CONN)
+	if ((ticker_id >= TICKER_ID_CONN_BASE) &&
+	    (ticker_id <= TICKER_ID_CONN_LAST)) {
+		struct ll_conn *conn;
+
+		conn = ll_conn_get(ticker_id - TICKER_ID_CONN_BASE);
+		if (!conn || ((filter & SCHED_FILTER_MSTR) && conn->lll.role)) {
+			return NULL;
+		}
+
+		return &conn->evt;
+	}
+#endif /* CONFIG_BT_CONN */
+
+	if (!(filter & SCHED_FILTER_ALL)) {
+		return NULL;
+	}
+
+#if defined(CONFIG_BT_BROADCASTER)
+	if ((ticker_id >= TICKER_ID_ADV_BASE) &&
+	    (ticker_id <= TICKER_ID_ADV_LAST)) {
+		struct ll_adv_set *adv;
+
+		adv = ull_adv_is_enabled_get(ticker_id - TICKER_ID_ADV_BASE);
+		if (!adv) {
+			return NULL;
+		}
+
+		return &adv->evt;
+	}
+#endif /* CONFIG_BT_BROADCASTER */
+
+#if defined(CONFIG_BT_OBSERVER)
+	if ((ticker_id >= TICKER_ID_SCAN_BASE) &&
+	    (ticker_id <= TICKER_ID_SCAN_LAST)) {
+		struct ll_scan_set *scan;
+
+		scan = ull_scan_is_enabled_get(ticker_id - TICKER_ID_SCAN_BASE);
+		if (!scan) {
+			return NULL;
+		}
+
+		return &scan->evt;
+	}
+#endif /* CONFIG_BT_OBSERVER */
+
+	return NULL;
+}
+
+static void free_slot_get(u8_t user_id, u8_t filter, u32_t ticks_slot_abs,
+			  u32_t *ticks_anchor, u32_t *us_offset)
+{
+	u32_t ticks_to_expire_prev;
+	u32_t ticks_slot_abs_prev;
+	u32_t ticks_to_expire;
+	u8_t ticker_id_prev;
+	u8_t ticker_id;
+
+	ticks_slot_abs += HAL_TICKER_US_TO_TICKS(EVENT_JITTER_US << 3);
+
+	ticker_id = ticker_id_prev = TICKER_NULL;
+	ticks_to_expire = ticks_to_expire_prev = *us_offset = 0U;
+	ticks_slot_abs_prev = 0U;
+	while (1) {
+		u32_t volatile ret_cb = TICKER_STATUS_BUSY;
+		u32_t ticks_to_expire_normal;
+		u32_t ticks_slot_abs_curr;
+		struct evt_hdr *evt;
+		u32_t ret;
+
+		ret = ticker_next_slot_get(TICKER_INSTANCE_ID_CTLR,
+					   user_id, &ticker_id, ticks_anchor,
+					   &ticks_to_expire, ticker_op_cb,
+					   (void *)&ret_cb);
+		if (ret == TICKER_STATUS_BUSY) {
+			while (ret_cb == TICKER_STATUS_BUSY) {
+				ticker_job_sched(TICKER_INSTANCE_ID_CTLR,
+						 user_id);
+			}
+		}
+
+		LL_ASSERT(ret_cb == TICKER_STATUS_SUCCESS);
+
+		if (ticker_id == TICKER_NULL) {
+			break;
+		}
+
+		evt = evt_hdr_get(ticker_id, filter);
+		if (!evt) {
+			continue;
+		}
+
+		ticks_to_expire_normal = ticks_to_expire;
+
+#if defined(CONFIG_BT_CTLR_XTAL_ADVANCED)
+		if (evt->ticks_xtal_to_start & XON_BITMASK) {
+			u32_t ticks_prepare_to_start =
+				MAX(evt->ticks_active_to_start,
+				    evt->ticks_preempt_to_start);
+
+			ticks_slot_abs_curr = evt->ticks_xtal_to_start &
+					      ~XON_BITMASK;
+			ticks_to_expire_normal -= ticks_slot_abs_curr -
+						  ticks_prepare_to_start;
+		} else
+#endif /* CONFIG_BT_CTLR_XTAL_ADVANCED */
+		{
+			u32_t ticks_prepare_to_start =
+				MAX(evt->ticks_active_to_start,
+				    evt->ticks_xtal_to_start);
+
+			ticks_slot_abs_curr = ticks_prepare_to_start;
+		}
+
+		ticks_slot_abs_curr += evt->ticks_slot +
+				       HAL_TICKER_US_TO_TICKS(EVENT_JITTER_US <<
+							      3);
+
+		/* Stop at the first gap, between the end of the previous
+		 * role and the start of this one, that fits the slot.
+		 */
+		if ((ticker_id_prev != TICKER_NULL) &&
+		    (ticker_ticks_diff_get(ticks_to_expire_normal,
+					   ticks_to_expire_prev) >
+		     (ticks_slot_abs_prev + ticks_slot_abs))) {
+			break;
+		}
+
+		/* Roles overlapping the previous one extend the busy time
+		 * space only if they end later.
+		 */
+		if ((ticker_id_prev == TICKER_NULL) ||
+		    ((ticks_to_expire_normal + ticks_slot_abs_curr) >
+		     (ticks_to_expire_prev + ticks_slot_abs_prev))) {
+			ticker_id_prev = ticker_id;
+			ticks_to_expire_prev = ticks_to_expire_normal;
+			ticks_slot_abs_prev = ticks_slot_abs_curr;
+		}
+	}
+
+	if (ticker_id_prev != TICKER_NULL) {
+		*us_offset = HAL_TICKER_TICKS_TO_US(ticks_to_expire_prev +
+						    ticks_slot_abs_prev) +
+			     (EVENT_JITTER_US << 3);
+	}
+}
+
+#if defined(CONFIG_BT_CENTRAL)
+static void after_mstr_offset_get(u16_t conn_interval, u32_t ticks_slot,
+				  u32_t ticks_anchor, u32_t *win_offset_us)
+{
+	u32_t ticks_anchor_offset = ticks_anchor;
+
+	free_slot_get(TICKER_USER_ID_ULL_LOW, SCHED_FILTER_MSTR,
+		      (HAL_TICKER_US_TO_TICKS(EVENT_OVERHEAD_XTAL_US) +
+		       ticks_slot), &ticks_anchor_offset, win_offset_us);
+
+	if (!*win_offset_us) {
+		return;
+	}
+
+	LL_ASSERT(!((ticks_anchor_offset - ticks_anchor) &
+		    BIT(HAL_TICKER_CNTR_MSBIT)));
+
+	*win_offset_us += HAL_TICKER_TICKS_TO_US(
+		ticker_ticks_diff_get(ticks_anchor_offset, ticks_anchor));
+
+	if ((*win_offset_us & BIT(31)) == 0) {
+		u32_t conn_interval_us = conn_interval * 1250;
+
+		while (*win_offset_us > conn_interval_us) {
+			*win_offset_us -= conn_interval_us;
+		}
+	}
+}
+#endif /* CONFIG_BT_CENTRAL */
+#endif /* CONFIG_BT_CTLR_SCHED_ADVANCED */
@@ -4,9 +4,32 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+enum ull_sched_role {
+	ULL_SCHED_ROLE_ADV,
+	ULL_SCHED_ROLE_SCAN,
+	ULL_SCHED_ROLE_MASTER,
+	ULL_SCHED_ROLE_SLAVE,
+
+	ULL_SCHED_ROLE_COUNT,
+};
+
 void ull_sched_after_mstr_slot_get(u8_t user_id, u32_t ticks_slot_abs,
 				   u32_t *ticks_anchor, u32_t *us_offset);
+void ull_sched_free_slot_get(u8_t user_id, u32_t ticks_slot_abs,
+			     u32_t *ticks_anchor, u32_t *us_offset);
 void ull_sched_mfy_after_mstr_offset_get(void *param);
 void ull_sched_mfy_free_win_offset_calc(void *param);
 void ull_sched_mfy_win_offset_use(void *param);
 void ull_sched_mfy_win_offset_select(void *param);
+
+#if defined(CONFIG_BT_CTLR_SCHED_STATS)
+void ull_sched_stats_evt(u8_t role, u16_t lazy, u16_t lazy_expected);
+#else /* !CONFIG_BT_CTLR_SCHED_STATS */
+static inline void ull_sched_stats_evt(u8_t role, u16_t lazy,
+				       u16_t lazy_expected)
+{
+	ARG_UNUSED(role);
+	ARG_UNUSED(lazy);
+	ARG_UNUSED(lazy_expected);
+}
+#endif /* !CONFIG_BT_CTLR_SCHED_STATS */
@@ -35,6 +35,7 @@
 #include "ull_internal.h"
 #include "ull_adv_internal.h"
 #include "ull_conn_internal.h"
+#include "ull_sched_internal.h"
 #include "ull_slave_internal.h"
 
 #define LOG_MODULE_NAME bt_ctlr_llsw_ull_slave
@@ -356,6 +357,12 @@ void ull_slave_ticker_cb(u32_t ticks_at_expire, u32_t remainder, u16_t lazy,
 		return;
 	}
 
+	/* Account scheduled and skipped events, skips due to latency are
+	 * not collisions.
+	 */
+	ull_sched_stats_evt(ULL_SCHED_ROLE_SLAVE, lazy,
+			    conn->lll.latency_event);
+
 	/* Increment prepare reference count */
 	ref = ull_ref_inc(&conn->ull);
 	LL_ASSERT(ref);
@@ -1334,7 +1334,7 @@ static bool send_frag(struct bt_conn *conn, struct net_buf *buf, u8_t flags,
 
 	hdr = net_buf_push(buf, sizeof(*hdr));
 	hdr->handle = sys_cpu_to_le16(bt_acl_handle_pack(conn->handle, flags));
-	hdr->len = sys_cpu_to_le16(buf->len - sizeof(*hdr));
+	hdr->len = sys_cpu_to_le16(net_buf_frags_len(buf) - sizeof(*hdr));
 
 	/* Add to pending, it must be done before bt_buf_set_type */
 	tx = add_pending_tx(conn, conn_tx(buf)->cb, conn_tx(buf)->user_data);
@@ -1397,6 +1397,124 @@ static struct net_buf *create_frag(struct bt_conn *conn, struct net_buf *buf)
 	return frag;
 }
 
+/* Send all but the last fragment of buf without copying them into
+ * fragment buffers. The ACL header of each fragment is pushed in front of
+ * the fragment data, overwriting the tail of the previous fragment, which
+ * is only safe if the HCI driver has copied the data out before bt_send()
+ * returns and nobody else holds a reference to buf.
+ */
+static bool send_frags_inplace(struct bt_conn *conn, struct net_buf *buf)
+{
+	struct bt_conn_tx_data data = *conn_tx(buf);
+	u8_t flags = BT_ACL_START_NO_FLUSH;
+
+	while (buf->len > conn_mtu(conn)) {
+		u16_t frag_len = conn_mtu(conn);
+		u16_t len = buf->len;
+
+		/* Fragments never have a TX completion callback */
+		conn_tx(buf)->cb = NULL;
+		conn_tx(buf)->user_data = NULL;
+
+		/* Expose only this fragment to the driver. The driver
+		 * consumes one reference, keep ours for the remainder.
+		 */
+		buf->len = frag_len;
+		if (!send_frag(conn, net_buf_ref(buf), flags, true)) {
+			return false;
+		}
+
+		/* Skip the ACL header and the fragment just sent */
+		net_buf_pull(buf, buf->len);
+		buf->len = len - frag_len;
+
+		flags = BT_ACL_CONT;
+	}
+
+	*conn_tx(buf) = data;
+
+	return send_frag(conn, buf, BT_ACL_CONT, false);
+}
+
+/* Send buf, whose data is spread over net_buf fragments, without copying
+ * the data. Each ACL fragment is exposed to the driver by cutting the
+ * fragment chain for the duration of bt_send(), and continuation fragments
+ * get their ACL header from a separate buffer. This is only possible if the
+ * HCI driver has copied the data out before bt_send() returns.
+ */
+static bool send_frags_chain(struct bt_conn *conn, struct net_buf *buf)
+{
+	struct bt_conn_tx_data tx = *conn_tx(buf);
+	u8_t flags = BT_ACL_START_NO_FLUSH;
+	struct net_buf *frag = buf;
+	struct net_buf *next;
+	struct net_buf *pkt;
+	struct net_buf *cut;
+	u8_t *data;
+	u16_t len;
+	u16_t rem;
+	bool sent;
+
+	while (frag) {
+		/* Find the buffer holding the last byte of this fragment */
+		cut = frag;
+		rem = conn_mtu(conn);
+		while (cut->len < rem && cut->frags) {
+			rem -= cut->len;
+			cut = cut->frags;
+		}
+
+		rem = MIN(rem, cut->len);
+		next = cut->frags;
+		data = cut->data;
+		len = cut->len;
+
+		if (flags == BT_ACL_START_NO_FLUSH) {
+			pkt = net_buf_ref(buf);
+		} else {
+#if CONFIG_BT_L2CAP_TX_FRAG_COUNT > 0
+			pkt = bt_conn_create_pdu(&frag_pool, 0);
+#else
+			pkt = bt_conn_create_pdu(NULL, 0);
+#endif
+			/* The driver releases pkt, and with it this extra
+			 * reference, buf keeps owning the fragments.
+			 */
+			net_buf_frag_add(pkt, net_buf_ref(frag));
+		}
+
+		if (!next && rem == len) {
+			/* Last fragment, it carries the TX callback */
+			*conn_tx(pkt) = tx;
+		} else {
+			conn_tx(pkt)->cb = NULL;
+			conn_tx(pkt)->user_data = NULL;
+		}
+
+		cut->frags = NULL;
+		cut->len = rem;
+
+		sent = send_frag(conn, pkt, flags, true);
+
+		/* Undo the cut, and the ACL header push if cut is buf */
+		cut->frags = next;
+		cut->data = data;
+		cut->len = len;
+
+		if (!sent) {
+			return false;
+		}
+
+		net_buf_pull(cut, rem);
+		frag = cut->len ? cut : next;
+		flags = BT_ACL_CONT;
+	}
+
+	net_buf_unref(buf);
+
+	return true;
+}
+
 static bool send_buf(struct bt_conn *conn, struct net_buf *buf)
 {
 	struct net_buf *frag;
@@ -1404,10 +1522,21 @@ static bool send_buf(struct bt_conn *conn, struct net_buf *buf)
 	BT_DBG("conn %p buf %p len %u", conn, buf, buf->len);
 
 	/* Send directly if the packet fits the ACL MTU */
-	if (buf->len <= conn_mtu(conn)) {
+	if (net_buf_frags_len(buf) <= conn_mtu(conn)) {
 		return send_frag(conn, buf, BT_ACL_START_NO_FLUSH, false);
 	}
 
+	/* Fragment in place if the driver copies the data synchronously */
+	if (bt_dev.drv->quirks & BT_QUIRK_ACL_TX_COPY) {
+		if (buf->frags) {
+			return send_frags_chain(conn, buf);
+		}
+
+		if (buf->ref == 1U) {
+			return send_frags_inplace(conn, buf);
+		}
+	}
+
 	/* Create & enqueue first fragment */
 	frag = create_frag(conn, buf);
 	if (!frag) {
@@ -498,11 +498,51 @@ static ssize_t cf_write(struct bt_conn *conn, const struct bt_gatt_attr *attr,
 static u8_t db_hash[16];
 struct k_delayed_work db_hash_work;
 
+/* Generating the hash takes several ms on slow cores, so it runs from its own
+ * work queue below the priority of the system work queue.
+ */
+static struct k_work_q db_hash_work_q;
+static K_THREAD_STACK_DEFINE(db_hash_work_q_stack,
+			     CONFIG_BT_GATT_DB_HASH_STACK_SIZE);
+
 struct gen_hash_state {
 	struct tc_cmac_struct state;
 	int err;
 };
 
+enum {
+	DB_HASH_PENDING,	/* Database changed since the last hash */
+	DB_HASH_CHANGED,	/* Changed handle not yet seen by a step */
+	DB_HASH_BASE_VALID,	/* Static services have been hashed */
+
+	/* Total number of flags - must be at the end of the enum */
+	DB_HASH_NUM_FLAGS,
+};
+
+/* The Database Hash is an AES-CMAC over the attributes in handle order, so
+ * the CMAC state after a given handle only depends on the attributes below
+ * it. The state after the static services is kept as a base, and the state
+ * after the last hashed dynamic service is kept so that appending a service
+ * only hashes the new attributes. The hash is generated one service per
+ * step, steps are serialized by the lock since the work queue thread can be
+ * preempted by a thread reading the hash.
+ */
+static struct {
+	struct k_mutex lock;
+	struct tc_aes_key_sched_struct sched;
+	struct gen_hash_state base;
+	struct gen_hash_state state;
+	/* Next handle to be hashed */
+	u16_t next;
+	/* Lowest handle changed since the last step, valid when
+	 * DB_HASH_CHANGED is set.
+	 */
+	u16_t changed;
+	/* Cycles spent generating the current hash */
+	u32_t cycles;
+	ATOMIC_DEFINE(flags, DB_HASH_NUM_FLAGS);
+} db_hash_ctx;
+
 static u8_t gen_hash_m(const struct bt_gatt_attr *attr, void *user_data)
 {
 	struct gen_hash_state *state = user_data;
@@ -589,22 +629,51 @@ static void db_hash_store(void)
 	BT_DBG("Database Hash stored");
 }
 
-static void db_hash_gen(bool store)
+static int db_hash_base_gen(void)
 {
 	u8_t key[16] = {};
-	struct tc_aes_key_sched_struct sched;
-	struct gen_hash_state state;
 
-	if (tc_cmac_setup(&state.state, key, &sched) == TC_CRYPTO_FAIL) {
+	if (tc_cmac_setup(&db_hash_ctx.base.state, key, &db_hash_ctx.sched) ==
+	    TC_CRYPTO_FAIL) {
 		BT_ERR("Unable to setup AES CMAC");
-		return;
+		return -EIO;
+	}
+
+	db_hash_ctx.base.err = 0;
+
+	/* Static services never change, hash them once */
+	if (last_static_handle) {
+		bt_gatt_foreach_attr(0x0001, last_static_handle, gen_hash_m,
+				     &db_hash_ctx.base);
+		if (db_hash_ctx.base.err) {
+			return db_hash_ctx.base.err;
+		}
 	}
 
-	bt_gatt_foreach_attr(0x0001, 0xffff, gen_hash_m, &state);
+	atomic_set_bit(db_hash_ctx.flags, DB_HASH_BASE_VALID);
+
+	return 0;
+}
 
-	if (tc_cmac_final(db_hash, &state.state) == TC_CRYPTO_FAIL) {
+static void db_hash_restart(void)
+{
+	db_hash_ctx.state = db_hash_ctx.base;
+	db_hash_ctx.next = last_static_handle + 1;
+	db_hash_ctx.cycles = 0U;
+}
+
+static int db_hash_final(bool store)
+{
+	struct tc_cmac_struct state;
+
+	/* Keep the state before finalizing so that services appended later on
+	 * can be hashed on top of it.
+	 */
+	state = db_hash_ctx.state.state;
+
+	if (tc_cmac_final(db_hash, &state) == TC_CRYPTO_FAIL) {
 		BT_ERR("Unable to calculate hash");
-		return;
+		return -EIO;
 	}
 
 	/**
@@ -617,15 +686,139 @@ static void db_hash_gen(bool store)
 	sys_mem_swap(db_hash, sizeof(db_hash));
 
 	BT_HEXDUMP_DBG(db_hash, sizeof(db_hash), "Hash: ");
+	BT_INFO("Hash generated in %u us",
+		k_cyc_to_us_floor32(db_hash_ctx.cycles));
+	db_hash_ctx.cycles = 0U;
 
 	if (IS_ENABLED(CONFIG_BT_SETTINGS) && store) {
 		db_hash_store();
 	}
+
+	/* Only clear pending if no change came in while finalizing, a change
+	 * sets DB_HASH_CHANGED before DB_HASH_PENDING.
+	 */
+	if (!atomic_test_bit(db_hash_ctx.flags, DB_HASH_CHANGED)) {
+		atomic_clear_bit(db_hash_ctx.flags, DB_HASH_PENDING);
+	}
+
+	return 0;
+}
+
+static bool db_hash_next(bool store)
+{
+#if defined(CONFIG_BT_GATT_DYNAMIC_DB)
+	struct bt_gatt_service *svc;
+#endif /* CONFIG_BT_GATT_DYNAMIC_DB */
+	u16_t end_handle = 0U;
+	u16_t changed = UINT16_MAX;
+	u32_t start;
+	int err;
+
+	if (!atomic_test_bit(db_hash_ctx.flags, DB_HASH_PENDING)) {
+		return true;
+	}
+
+	start = k_cycle_get_32();
+
+	if (atomic_test_and_clear_bit(db_hash_ctx.flags, DB_HASH_CHANGED)) {
+		changed = db_hash_ctx.changed;
+	}
+
+	if (!atomic_test_bit(db_hash_ctx.flags, DB_HASH_BASE_VALID)) {
+		err = db_hash_base_gen();
+		if (err) {
+			goto failed;
+		}
+
+		db_hash_restart();
+	} else if (changed < db_hash_ctx.next) {
+		/* Attributes already hashed have changed */
+		db_hash_restart();
+	}
+
+#if defined(CONFIG_BT_GATT_DYNAMIC_DB)
+	SYS_SLIST_FOR_EACH_CONTAINER(&db, svc, node) {
+		if (svc->attrs[0].handle >= db_hash_ctx.next) {
+			end_handle = svc->attrs[svc->attr_count - 1].handle;
+			break;
+		}
+	}
+#endif /* CONFIG_BT_GATT_DYNAMIC_DB */
+
+	if (end_handle) {
+		bt_gatt_foreach_attr(db_hash_ctx.next, end_handle, gen_hash_m,
+				     &db_hash_ctx.state);
+		if (db_hash_ctx.state.err) {
+			err = db_hash_ctx.state.err;
+			goto failed;
+		}
+
+		db_hash_ctx.next = end_handle + 1;
+		db_hash_ctx.cycles += k_cycle_get_32() - start;
+
+		return false;
+	}
+
+	db_hash_ctx.cycles += k_cycle_get_32() - start;
+
+	err = db_hash_final(store);
+	if (err) {
+		goto failed;
+	}
+
+	return !atomic_test_bit(db_hash_ctx.flags, DB_HASH_PENDING);
+
+failed:
+	BT_ERR("Unable to generate hash (err %d)", err);
+	atomic_clear_bit(db_hash_ctx.flags, DB_HASH_BASE_VALID);
+	atomic_clear_bit(db_hash_ctx.flags, DB_HASH_PENDING);
+
+	return true;
+}
+
+/* Hash the next service, returns true when done */
+static bool db_hash_step(bool store)
+{
+	bool done;
+
+	k_mutex_lock(&db_hash_ctx.lock, K_FOREVER);
+	done = db_hash_next(store);
+	k_mutex_unlock(&db_hash_ctx.lock);
+
+	return done;
+}
+
+static void db_hash_gen(bool store)
+{
+	while (!db_hash_step(store)) {
+	}
+}
+
+static void db_hash_invalidate(u16_t start_handle)
+{
+	/* A step clears DB_HASH_CHANGED before reading the handle, so at worst
+	 * a change is seen twice, which only restarts the hash once more.
+	 */
+	if (!atomic_test_bit(db_hash_ctx.flags, DB_HASH_CHANGED) ||
+	    start_handle < db_hash_ctx.changed) {
+		db_hash_ctx.changed = start_handle;
+	}
+
+	atomic_set_bit(db_hash_ctx.flags, DB_HASH_CHANGED);
+	atomic_set_bit(db_hash_ctx.flags, DB_HASH_PENDING);
+
+	/* Coalesce bursts of changes before hashing */
+	k_delayed_work_submit_to_queue(&db_hash_work_q, &db_hash_work,
+				       DB_HASH_TIMEOUT);
 }
 
 static void db_hash_process(struct k_work *work)
 {
-	db_hash_gen(true);
+	if (!db_hash_step(true)) {
+		/* Let other work items run between services */
+		k_delayed_work_submit_to_queue(&db_hash_work_q, &db_hash_work,
+					       K_NO_WAIT);
+	}
 }
 
 static ssize_t db_hash_read(struct bt_conn *conn,
@@ -635,7 +828,7 @@ static ssize_t db_hash_read(struct bt_conn *conn,
 	/* Check if db_hash is already pending in which case it shall be
 	 * generated immediately instead of waiting the work to complete.
 	 */
-	if (k_delayed_work_remaining_get(&db_hash_work)) {
+	if (atomic_test_bit(db_hash_ctx.flags, DB_HASH_PENDING)) {
 		k_delayed_work_cancel(&db_hash_work);
 		db_hash_gen(true);
 	}
@@ -934,12 +1127,17 @@ void bt_gatt_init(void)
 	}
 
 #if defined(CONFIG_BT_GATT_CACHING)
+	k_mutex_init(&db_hash_ctx.lock);
+	k_work_q_start(&db_hash_work_q, db_hash_work_q_stack,
+		       K_THREAD_STACK_SIZEOF(db_hash_work_q_stack),
+		       K_PRIO_PREEMPT(CONFIG_BT_GATT_DB_HASH_PRIO));
+	k_thread_name_set(&db_hash_work_q.thread, "BT DB hash");
 	k_delayed_work_init(&db_hash_work, db_hash_process);
 
 	/* Submit work to Generate initial hash as there could be static
 	 * services already in the database.
 	 */
-	k_delayed_work_submit(&db_hash_work, DB_HASH_TIMEOUT);
+	db_hash_invalidate(0x0001);
 #endif /* CONFIG_BT_GATT_CACHING */
 
 	if (IS_ENABLED(CONFIG_BT_GATT_SERVICE_CHANGED)) {
@@ -985,12 +1183,12 @@ submit:
 #endif /* BT_GATT_DYNAMIC_DB || (BT_GATT_CACHING && BT_SETTINGS) */
 
 #if defined(CONFIG_BT_GATT_DYNAMIC_DB)
-static void db_changed(void)
+static void db_changed(u16_t start_handle)
 {
 #if defined(CONFIG_BT_GATT_CACHING)
 	int i;
 
-	k_delayed_work_submit(&db_hash_work, DB_HASH_TIMEOUT);
+	db_hash_invalidate(start_handle);
 
 	for (i = 0; i < ARRAY_SIZE(cf_cfg); i++) {
 		struct gatt_cf_cfg *cfg = &cf_cfg[i];
@@ -1041,7 +1239,7 @@ int bt_gatt_service_register(struct bt_gatt_service *svc)
 	sc_indicate(svc->attrs[0].handle,
 		    svc->attrs[svc->attr_count - 1].handle);
 
-	db_changed();
+	db_changed(svc->attrs[0].handle);
 
 	return 0;
 }
@@ -1057,7 +1255,7 @@ int bt_gatt_service_unregister(struct bt_gatt_service *svc)
 	sc_indicate(svc->attrs[0].handle,
 		    svc->attrs[svc->attr_count - 1].handle);
 
-	db_changed();
+	db_changed(svc->attrs[0].handle);
 
 	return 0;
 }
@@ -4314,7 +4512,7 @@ static int db_hash_set(const char *name, size_t len_rd,
 static int db_hash_commit(void)
 {
 	/* Stop work and generate the hash */
-	if (k_delayed_work_remaining_get(&db_hash_work)) {
+	if (atomic_test_bit(db_hash_ctx.flags, DB_HASH_PENDING)) {
 		k_delayed_work_cancel(&db_hash_work);
 		db_hash_gen(false);
 	}
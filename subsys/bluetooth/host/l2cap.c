@@ -63,6 +63,16 @@
 
 static sys_slist_t servers;
 
+#if CONFIG_BT_L2CAP_TX_SLICE_COUNT > 0
+static void slice_destroy(struct net_buf *buf);
+
+/* Buffers referencing the data of a segmented SDU, each one holding a
+ * reference to the SDU buffer until its segment has been sent.
+ */
+NET_BUF_POOL_FIXED_DEFINE(slice_pool, CONFIG_BT_L2CAP_TX_SLICE_COUNT, 0,
+			  slice_destroy);
+#endif /* CONFIG_BT_L2CAP_TX_SLICE_COUNT > 0 */
+
 #endif /* CONFIG_BT_L2CAP_DYNAMIC_CHANNEL */
 
 /* L2CAP signalling channel specific context */
@@ -494,7 +504,7 @@ void bt_l2cap_send_cb(struct bt_conn *conn, u16_t cid, struct net_buf *buf,
 	BT_DBG("conn %p cid %u len %zu", conn, cid, net_buf_frags_len(buf));
 
 	hdr = net_buf_push(buf, sizeof(*hdr));
-	hdr->len = sys_cpu_to_le16(buf->len - sizeof(*hdr));
+	hdr->len = sys_cpu_to_le16(net_buf_frags_len(buf) - sizeof(*hdr));
 	hdr->cid = sys_cpu_to_le16(cid);
 
 	bt_conn_send_cb(conn, buf, cb, user_data);
@@ -1108,10 +1118,49 @@ static inline struct net_buf *l2cap_alloc_seg(struct net_buf *buf)
 	return bt_l2cap_create_pdu(NULL, 0);
 }
 
+#if CONFIG_BT_L2CAP_TX_SLICE_COUNT > 0
+static void slice_destroy(struct net_buf *buf)
+{
+	struct net_buf *sdu = *(struct net_buf **)net_buf_user_data(buf);
+
+	net_buf_destroy(buf);
+	net_buf_unref(sdu);
+}
+
+static struct net_buf *l2cap_alloc_slice(struct net_buf *buf, u16_t len)
+{
+	struct net_buf *slice;
+
+	/* Only drivers copying the data synchronously accept ACL packets
+	 * with data in fragments.
+	 */
+	if (!(bt_dev.drv->quirks & BT_QUIRK_ACL_TX_COPY)) {
+		return NULL;
+	}
+
+	slice = net_buf_alloc_with_data(&slice_pool, buf->data, len,
+					K_NO_WAIT);
+	if (!slice) {
+		return NULL;
+	}
+
+	*(struct net_buf **)net_buf_user_data(slice) = net_buf_ref(buf);
+
+	return slice;
+}
+#else
+static inline struct net_buf *l2cap_alloc_slice(struct net_buf *buf,
+						u16_t len)
+{
+	return NULL;
+}
+#endif /* CONFIG_BT_L2CAP_TX_SLICE_COUNT > 0 */
+
 static struct net_buf *l2cap_chan_create_seg(struct bt_l2cap_le_chan *ch,
 					     struct net_buf *buf,
 					     size_t sdu_hdr_len)
 {
+	struct net_buf *frag;
 	struct net_buf *seg;
 	u16_t headroom;
 	u16_t len;
@@ -1144,6 +1193,18 @@ segment:
 		net_buf_add_le16(seg, net_buf_frags_len(buf));
 	}
 
+	/* Reference the segment data in the original buffer if possible */
+	len = MIN(buf->len, ch->tx.mps - sdu_hdr_len);
+	frag = l2cap_alloc_slice(buf, len);
+	if (frag) {
+		net_buf_frag_add(seg, frag);
+		net_buf_pull(buf, len);
+
+		BT_DBG("ch %p seg %p len %u", ch, seg, len);
+
+		return seg;
+	}
+
 	/* Don't send more that TX MPS including SDU length */
 	len = MIN(net_buf_tailroom(seg), ch->tx.mps - sdu_hdr_len);
 	/* Limit if original buffer is smaller than the segment */
@@ -1190,10 +1251,11 @@ static int l2cap_chan_le_send(struct bt_l2cap_le_chan *ch, struct net_buf *buf,
 		return -ECONNRESET;
 	}
 
+	len = net_buf_frags_len(seg) - sdu_hdr_len;
+
 	BT_DBG("ch %p cid 0x%04x len %u credits %u", ch, ch->tx.cid,
-	       seg->len, k_sem_count_get(&ch->tx.credits));
+	       len + sdu_hdr_len, k_sem_count_get(&ch->tx.credits));
 
-	len = seg->len - sdu_hdr_len;
 
 	/* Set a callback if there is no data left in the buffer and sent
 	 * callback has been set.
@@ -1691,6 +1691,12 @@ SHELL_STATIC_SUBCMD_SET_CREATE(bt_cmds,
 #endif /* defined(CONFIG_BT_LL_SW_LEGACY) || defined(CONFIG_BT_LL_SW_SPLIT) */
 #if defined(CONFIG_BT_LL_SW_SPLIT)
 	SHELL_CMD(ull_reset, NULL, HELP_NONE, cmd_ull_reset),
+#if defined(CONFIG_BT_CTLR_PROFILE_HIST)
+	SHELL_CMD_ARG(ull_prof, NULL, "[reset]", cmd_ull_prof, 1, 1),
+#endif /* CONFIG_BT_CTLR_PROFILE_HIST */
+#if defined(CONFIG_BT_CTLR_SCHED_STATS)
+	SHELL_CMD_ARG(ull_sched, NULL, "[reset]", cmd_ull_sched, 1, 1),
+#endif /* CONFIG_BT_CTLR_SCHED_STATS */
 #endif /* CONFIG_BT_LL_SW_SPLIT */
 	SHELL_SUBCMD_SET_END
 );
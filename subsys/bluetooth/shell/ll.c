@@ -348,4 +348,97 @@ int cmd_ull_reset(const struct shell *shell, size_t  argc, char *argv[])
 	return 0;
 }
 
+#if defined(CONFIG_BT_CTLR_PROFILE_HIST)
+static void prof_hist_print(const struct shell *shell, const char *name,
+			    struct ll_prof_hist *hist)
+{
+	u8_t i;
+
+	if (!hist->count) {
+		shell_print(shell, "%-8s -", name);
+		return;
+	}
+
+	shell_fprintf(shell, SHELL_NORMAL, "%-8s %8u %6u %6u", name,
+		      hist->count, hist->min, hist->max);
+	for (i = 0U; i < LL_PROF_HIST_BUCKETS; i++) {
+		shell_fprintf(shell, SHELL_NORMAL, " %u", hist->bucket[i]);
+	}
+	shell_fprintf(shell, SHELL_NORMAL, "\n");
+}
+
+int cmd_ull_prof(const struct shell *shell, size_t  argc, char *argv[])
+{
+	static const char * const isr_name[] = {
+		"radio", "ticker", "ull_high", "ull_low", "lll",
+	};
+	static const char * const role_name[] = {
+		"none", "adv", "scan", "master", "slave",
+	};
+	struct ll_prof_hist hist;
+	const char *name;
+	u8_t i;
+
+	if (argc > 1) {
+		if (strcmp(argv[1], "reset")) {
+			return -EINVAL;
+		}
+
+		ll_prof_hist_reset();
+
+		return 0;
+	}
+
+	shell_print(shell, "Bucket n counts durations in [2^(n-1), 2^n) us, "
+		    "the last one all above.");
+	shell_print(shell, "%-8s %8s %6s %6s buckets", "ISR", "count",
+		    "min us", "max us");
+	for (i = 0U; !ll_prof_hist_isr_get(i, &hist); i++) {
+		name = (i < ARRAY_SIZE(isr_name)) ? isr_name[i] : "?";
+		prof_hist_print(shell, name, &hist);
+	}
+
+	shell_print(shell, "%-8s %8s %6s %6s buckets", "Radio", "count",
+		    "min us", "max us");
+	for (i = 0U; !ll_prof_hist_role_get(i, &hist); i++) {
+		name = (i < ARRAY_SIZE(role_name)) ? role_name[i] : "?";
+		prof_hist_print(shell, name, &hist);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_BT_CTLR_PROFILE_HIST */
+
+#if defined(CONFIG_BT_CTLR_SCHED_STATS)
+int cmd_ull_sched(const struct shell *shell, size_t  argc, char *argv[])
+{
+	static const char * const role_name[] = {
+		"adv", "scan", "master", "slave",
+	};
+	struct ll_sched_stats stats;
+	bool reset = false;
+	u8_t i;
+
+	if (argc > 1) {
+		if (strcmp(argv[1], "reset")) {
+			return -EINVAL;
+		}
+
+		reset = true;
+	}
+
+	shell_print(shell, "%-8s %10s %10s", "Role", "events", "skipped");
+	for (i = 0U; i < ARRAY_SIZE(role_name); i++) {
+		if (ll_sched_stats_get(i, &stats, reset)) {
+			break;
+		}
+
+		shell_print(shell, "%-8s %10u %10u", role_name[i],
+			    stats.events, stats.skipped);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_BT_CTLR_SCHED_STATS */
+
 #endif /* CONFIG_BT_LL_SW_SPLIT */
@@ -23,4 +23,6 @@ int cmd_test_rx(const struct shell *shell, size_t  argc, char *argv[]);
 int cmd_test_end(const struct shell *shell, size_t  argc, char *argv[]);
 
 int cmd_ull_reset(const struct shell *shell, size_t  argc, char *argv[]);
+int cmd_ull_prof(const struct shell *shell, size_t  argc, char *argv[]);
+int cmd_ull_sched(const struct shell *shell, size_t  argc, char *argv[]);
 #endif /* __LL_H */
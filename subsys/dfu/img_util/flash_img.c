@@ -18,6 +18,11 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 #include <dfu/flash_img.h>
 #include <inttypes.h>
 
+#ifdef CONFIG_IMG_ASYNC_WRITE
+#include <kernel.h>
+#include <init.h>
+#endif
+
 #ifdef CONFIG_IMG_ERASE_PROGRESSIVELY
 #include <dfu/mcuboot.h>
 #include <drivers/flash.h>
@@ -123,43 +128,146 @@ static int flash_progressive_erase(struct flash_img_context *ctx, off_t off)
 
 #endif /* CONFIG_IMG_ERASE_PROGRESSIVELY */
 
-static int flash_sync(struct flash_img_context *ctx)
+static int flash_block_write(struct flash_img_context *ctx, size_t off,
+			     u8_t *buf, u16_t len)
 {
 	int rc = 0;
 
-	if (ctx->buf_bytes < CONFIG_IMG_BLOCK_BUF_SIZE) {
-		(void)memset(ctx->buf + ctx->buf_bytes, 0xFF,
-			     CONFIG_IMG_BLOCK_BUF_SIZE - ctx->buf_bytes);
+	if (len < CONFIG_IMG_BLOCK_BUF_SIZE) {
+		(void)memset(buf + len, 0xFF, CONFIG_IMG_BLOCK_BUF_SIZE - len);
 	}
 
 #ifdef CONFIG_IMG_ERASE_PROGRESSIVELY
-	rc = flash_progressive_erase(ctx, ctx->bytes_written +
-				     CONFIG_IMG_BLOCK_BUF_SIZE);
+	rc = flash_progressive_erase(ctx, off + CONFIG_IMG_BLOCK_BUF_SIZE);
 	if (rc) {
 		LOG_ERR("flash_progressive_erase error %d offset=0x%08zx", rc,
-			ctx->bytes_written);
+			off);
 		return rc;
 	}
 #endif
 
-	rc = flash_area_write(ctx->flash_area, ctx->bytes_written, ctx->buf,
+	rc = flash_area_write(ctx->flash_area, off, buf,
 			      CONFIG_IMG_BLOCK_BUF_SIZE);
 	if (rc) {
-		LOG_ERR("flash_write error %d offset=0x%08zx", rc,
-			ctx->bytes_written);
+		LOG_ERR("flash_write error %d offset=0x%08zx", rc, off);
 		return rc;
 	}
 
-	if (!flash_verify(ctx->flash_area, ctx->bytes_written, ctx->buf,
+	if (!flash_verify(ctx->flash_area, off, buf,
 			  CONFIG_IMG_BLOCK_BUF_SIZE)) {
 		return -EIO;
 	}
 
+	return rc;
+}
+
+#ifdef CONFIG_IMG_ASYNC_WRITE
+/*
+ * Full blocks are copied to a second buffer and programmed by a dedicated
+ * work queue thread, so that the caller can receive and buffer the next
+ * block meanwhile. At most one block is in flight per context: ctx->idle
+ * is taken while the work item owns ctx->wbuf and ctx->wbuf_off, and
+ * ctx->wr_rc carries the result back to the next call. ctx->bytes_written
+ * is only updated by the caller, when a block is handed over.
+ */
+static K_THREAD_STACK_DEFINE(img_write_stack,
+			     CONFIG_IMG_ASYNC_WRITE_STACK_SIZE);
+static struct k_work_q img_write_work_q;
+
+static void flash_write_work_handler(struct k_work *work)
+{
+	struct flash_img_context *ctx =
+		CONTAINER_OF(work, struct flash_img_context, work);
+
+	size_t next_off = ctx->wbuf_off + ctx->wbuf_bytes;
+
+	ctx->wr_rc = flash_block_write(ctx, ctx->wbuf_off, ctx->wbuf,
+				       ctx->wbuf_bytes);
+
+#ifdef CONFIG_IMG_ERASE_PROGRESSIVELY
+	/* Erase the sector of the next block ahead of time, while the
+	 * caller is still filling it.
+	 */
+	if (!ctx->wr_rc && (next_off + CONFIG_IMG_BLOCK_BUF_SIZE <
+			    ctx->flash_area->fa_size)) {
+		ctx->wr_rc = flash_progressive_erase(ctx, next_off +
+						     CONFIG_IMG_BLOCK_BUF_SIZE);
+	}
+#endif
+
+	k_sem_give(&ctx->idle);
+}
+
+static int flash_wait(struct flash_img_context *ctx)
+{
+	int rc;
+
+	k_sem_take(&ctx->idle, K_FOREVER);
+	rc = ctx->wr_rc;
+	k_sem_give(&ctx->idle);
+
+	return rc;
+}
+
+static int flash_sync(struct flash_img_context *ctx)
+{
+	int rc;
+
+	k_sem_take(&ctx->idle, K_FOREVER);
+
+	rc = ctx->wr_rc;
+	if (rc) {
+		k_sem_give(&ctx->idle);
+		return rc;
+	}
+
+	memcpy(ctx->wbuf, ctx->buf, ctx->buf_bytes);
+	ctx->wbuf_bytes = ctx->buf_bytes;
+	ctx->wbuf_off = ctx->bytes_written;
+	ctx->bytes_written += ctx->buf_bytes;
+	ctx->buf_bytes = 0U;
+
+	k_work_submit_to_queue(&img_write_work_q, &ctx->work);
+
+	return 0;
+}
+
+static int flash_img_async_init(struct device *unused)
+{
+	ARG_UNUSED(unused);
+
+	k_work_q_start(&img_write_work_q, img_write_stack,
+		       K_THREAD_STACK_SIZEOF(img_write_stack),
+		       CONFIG_IMG_ASYNC_WRITE_PRIORITY);
+	k_thread_name_set(&img_write_work_q.thread, "img_write");
+
+	return 0;
+}
+
+SYS_INIT(flash_img_async_init, POST_KERNEL,
+	 CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#else
+static inline int flash_wait(struct flash_img_context *ctx)
+{
+	return 0;
+}
+
+static int flash_sync(struct flash_img_context *ctx)
+{
+	int rc;
+
+	rc = flash_block_write(ctx, ctx->bytes_written, ctx->buf,
+			       ctx->buf_bytes);
+	if (rc) {
+		return rc;
+	}
+
 	ctx->bytes_written += ctx->buf_bytes;
 	ctx->buf_bytes = 0U;
 
 	return rc;
 }
+#endif /* CONFIG_IMG_ASYNC_WRITE */
 
 int flash_img_buffered_write(struct flash_img_context *ctx, u8_t *data,
 			     size_t len, bool flush)
@@ -168,6 +276,12 @@ int flash_img_buffered_write(struct flash_img_context *ctx, u8_t *data,
 	int rc = 0;
 	int buf_empty_bytes;
 
+#ifdef CONFIG_IMG_STREAM_HASH
+	if (len > 0) {
+		(void)tc_sha256_update(&ctx->sha256, data, len);
+	}
+#endif
+
 	while ((len - processed) >=
 	       (buf_empty_bytes = CONFIG_IMG_BLOCK_BUF_SIZE - ctx->buf_bytes)) {
 		memcpy(ctx->buf + ctx->buf_bytes, data + processed,
@@ -202,6 +316,12 @@ int flash_img_buffered_write(struct flash_img_context *ctx, u8_t *data,
 			return rc;
 		}
 	}
+
+	rc = flash_wait(ctx);
+	if (rc) {
+		return rc;
+	}
+
 #ifdef CONFIG_IMG_ERASE_PROGRESSIVELY
 	/* erase the image trailer area if it was not erased */
 	rc = flash_progressive_erase(ctx,
@@ -211,6 +331,11 @@ int flash_img_buffered_write(struct flash_img_context *ctx, u8_t *data,
 	}
 #endif
 
+#ifdef CONFIG_IMG_STREAM_HASH
+	(void)tc_sha256_final(ctx->digest, &ctx->sha256);
+	ctx->finalized = true;
+#endif
+
 	flash_area_close(ctx->flash_area);
 	ctx->flash_area = NULL;
 
@@ -222,12 +347,36 @@ size_t flash_img_bytes_written(struct flash_img_context *ctx)
 	return ctx->bytes_written;
 }
 
+#ifdef CONFIG_IMG_STREAM_HASH
+int flash_img_hash_get(struct flash_img_context *ctx, u8_t *digest)
+{
+	if (!ctx->finalized) {
+		return -EBUSY;
+	}
+
+	memcpy(digest, ctx->digest, sizeof(ctx->digest));
+
+	return 0;
+}
+#endif
+
 int flash_img_init(struct flash_img_context *ctx)
 {
 	ctx->bytes_written = 0;
 	ctx->buf_bytes = 0U;
 #ifdef CONFIG_IMG_ERASE_PROGRESSIVELY
 	ctx->off_last = -1;
+#endif
+#ifdef CONFIG_IMG_ASYNC_WRITE
+	ctx->wbuf_bytes = 0U;
+	ctx->wbuf_off = 0;
+	ctx->wr_rc = 0;
+	k_work_init(&ctx->work, flash_write_work_handler);
+	k_sem_init(&ctx->idle, 1, 1);
+#endif
+#ifdef CONFIG_IMG_STREAM_HASH
+	(void)tc_sha256_init(&ctx->sha256);
+	ctx->finalized = false;
 #endif
 	return flash_area_open(FLASH_AREA_IMAGE_SECONDARY,
 			       (const struct flash_area **)&(ctx->flash_area));
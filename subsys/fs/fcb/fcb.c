@@ -49,6 +49,63 @@ int fcb_flash_read(const struct fcb *fcb, const struct flash_sector *sector,
 	return 0;
 }
 
+#if defined(CONFIG_FCB_READ_CACHE)
+int fcb_flash_read_cached(struct fcb *fcb, const struct flash_sector *sector,
+			  off_t off, void *dst, size_t len)
+{
+	u8_t *dst8 = dst;
+	u32_t chunk_off;
+	size_t cnt;
+	int rc;
+
+	if (off + len > sector->fs_size) {
+		return -EINVAL;
+	}
+
+	while (len) {
+		if (fcb->f_cache_sector != sector || off < fcb->f_cache_off ||
+		    off >= fcb->f_cache_off + fcb->f_cache_len) {
+			/* Read ahead the aligned chunk holding the offset */
+			chunk_off = off - off % sizeof(fcb->f_cache);
+			cnt = MIN(sizeof(fcb->f_cache),
+				  sector->fs_size - chunk_off);
+
+			fcb->f_cache_len = 0U;
+			rc = fcb_flash_read(fcb, sector, chunk_off,
+					    fcb->f_cache, cnt);
+			if (rc) {
+				return rc;
+			}
+
+			fcb->f_cache_sector = sector;
+			fcb->f_cache_off = chunk_off;
+			fcb->f_cache_len = cnt;
+		}
+
+		cnt = MIN(len, fcb->f_cache_off + fcb->f_cache_len - off);
+		memcpy(dst8, &fcb->f_cache[off - fcb->f_cache_off], cnt);
+		dst8 += cnt;
+		off += cnt;
+		len -= cnt;
+	}
+
+	return 0;
+}
+
+void fcb_cache_invalidate(const struct fcb *fcb,
+			  const struct flash_sector *sector)
+{
+	/* Only the internal state is modified, under the FCB lock */
+	struct fcb *fcb_rw = (struct fcb *)fcb;
+
+	k_mutex_lock(&fcb_rw->f_mtx, K_FOREVER);
+	if (fcb_rw->f_cache_sector == sector) {
+		fcb_rw->f_cache_len = 0U;
+	}
+	k_mutex_unlock(&fcb_rw->f_mtx);
+}
+#endif /* CONFIG_FCB_READ_CACHE */
+
 int fcb_flash_write(const struct fcb *fcb, const struct flash_sector *sector,
 		    off_t off, const void *src, size_t len)
 {
@@ -64,6 +121,8 @@ int fcb_flash_write(const struct fcb *fcb, const struct flash_sector *sector,
 
 	rc = flash_area_write(fcb->fap, sector->fs_off + off, src, len);
 
+	fcb_cache_invalidate(fcb, sector);
+
 	if (rc != 0) {
 		return -EIO;
 	}
@@ -82,6 +141,8 @@ fcb_erase_sector(const struct fcb *fcb, const struct flash_sector *sector)
 
 	rc = flash_area_erase(fcb->fap, sector->fs_off, sector->fs_size);
 
+	fcb_cache_invalidate(fcb, sector);
+
 	if (rc != 0) {
 		return -EIO;
 	}
@@ -109,6 +170,12 @@ fcb_init(int f_area_id, struct fcb *fcb)
 		return -EINVAL;
 	}
 
+	k_mutex_init(&fcb->f_mtx);
+#if defined(CONFIG_FCB_READ_CACHE)
+	fcb->f_cache_sector = NULL;
+	fcb->f_cache_len = 0U;
+#endif /* CONFIG_FCB_READ_CACHE */
+
 	align = fcb_get_align(fcb);
 	if (align == 0U) {
 		return -EINVAL;
@@ -164,7 +231,6 @@ fcb_init(int f_area_id, struct fcb *fcb)
 			break;
 		}
 	}
-	k_mutex_init(&fcb->f_mtx);
 	return rc;
 }
 
@@ -123,15 +123,25 @@ fcb_append_finish(struct fcb *fcb, struct fcb_entry *loc)
 
 	(void)memset(crc8, 0xFF, sizeof(crc8));
 
+	rc = k_mutex_lock(&fcb->f_mtx, K_FOREVER);
+	if (rc) {
+		return -EINVAL;
+	}
+
+	/* The element data was written directly to the flash area */
+	fcb_cache_invalidate(fcb, loc->fe_sector);
+
 	rc = fcb_elem_crc8(fcb, loc, &crc8[0]);
 	if (rc) {
-		return rc;
+		goto out;
 	}
 	off = loc->fe_data_off + fcb_len_in_flash(fcb, loc->fe_data_len);
 
 	rc = fcb_flash_write(fcb, loc->fe_sector, off, crc8, fcb->f_align);
 	if (rc) {
-		return -EIO;
+		rc = -EIO;
 	}
-	return 0;
+out:
+	k_mutex_unlock(&fcb->f_mtx);
+	return rc;
 }
@@ -29,7 +29,8 @@ fcb_elem_crc8(struct fcb *fcb, struct fcb_entry *loc, u8_t *c8p)
 	if (loc->fe_elem_off + 2 > loc->fe_sector->fs_size) {
 		return -ENOTSUP;
 	}
-	rc = fcb_flash_read(fcb, loc->fe_sector, loc->fe_elem_off, tmp_str, 2);
+	rc = fcb_flash_read_cached(fcb, loc->fe_sector, loc->fe_elem_off,
+				   tmp_str, 2);
 	if (rc) {
 		return -EIO;
 	}
@@ -52,7 +53,8 @@ fcb_elem_crc8(struct fcb *fcb, struct fcb_entry *loc, u8_t *c8p)
 			blk_sz = sizeof(tmp_str);
 		}
 
-		rc = fcb_flash_read(fcb, loc->fe_sector, off, tmp_str, blk_sz);
+		rc = fcb_flash_read_cached(fcb, loc->fe_sector, off, tmp_str,
+					   blk_sz);
 		if (rc) {
 			return -EIO;
 		}
@@ -76,7 +78,8 @@ int fcb_elem_info(struct fcb *fcb, struct fcb_entry *loc)
 	}
 	off = loc->fe_data_off + fcb_len_in_flash(fcb, loc->fe_data_len);
 
-	rc = fcb_flash_read(fcb, loc->fe_sector, off, &fl_crc8, sizeof(fl_crc8));
+	rc = fcb_flash_read_cached(fcb, loc->fe_sector, off, &fl_crc8,
+				   sizeof(fl_crc8));
 	if (rc) {
 		return -EIO;
 	}
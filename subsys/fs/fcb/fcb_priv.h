@@ -44,6 +44,29 @@ struct flash_sector *fcb_getnext_sector(struct fcb *fcb,
 					struct flash_sector *sector);
 int fcb_getnext_nolock(struct fcb *fcb, struct fcb_entry *loc);
 
+/*
+ * Reads of the FCB element metadata. Served from the per-FCB read cache
+ * when enabled, must be called with the FCB lock held.
+ */
+#if defined(CONFIG_FCB_READ_CACHE)
+int fcb_flash_read_cached(struct fcb *fcb, const struct flash_sector *sector,
+			  off_t off, void *dst, size_t len);
+void fcb_cache_invalidate(const struct fcb *fcb,
+			  const struct flash_sector *sector);
+#else
+static inline int fcb_flash_read_cached(struct fcb *fcb,
+					const struct flash_sector *sector,
+					off_t off, void *dst, size_t len)
+{
+	return fcb_flash_read(fcb, sector, off, dst, len);
+}
+
+static inline void fcb_cache_invalidate(const struct fcb *fcb,
+					const struct flash_sector *sector)
+{
+}
+#endif /* CONFIG_FCB_READ_CACHE */
+
 int fcb_elem_info(struct fcb *fcb, struct fcb_entry *loc);
 int fcb_elem_crc8(struct fcb *fcb, struct fcb_entry *loc, u8_t *crc8p);
 
@@ -132,12 +132,231 @@ static int errno_to_lfs(int error)
 }
 
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+/* Block cache shared by all mounts.  Reads are served from cache lines
+ * of CONFIG_FS_LITTLEFS_BLOCK_CACHE_LINE_SIZE bytes, evicted in least
+ * recently used order.  Programs update the lines they overlap and
+ * erases drop the lines of the erased block, so flash and cache never
+ * disagree.
+ */
+#define CACHE_LINE_SIZE CONFIG_FS_LITTLEFS_BLOCK_CACHE_LINE_SIZE
+
+BUILD_ASSERT(CONFIG_FS_LITTLEFS_BLOCK_CACHE_LINES >
+	     CONFIG_FS_LITTLEFS_BLOCK_CACHE_READ_AHEAD);
+
+struct lfs_cache_line {
+	const struct flash_area *area;	/* NULL if the line is free */
+	lfs_block_t block;
+	lfs_off_t off;			/* line aligned offset in block */
+	u32_t stamp;			/* last use, for LRU eviction */
+	u8_t data[CACHE_LINE_SIZE];
+};
+
+static struct lfs_cache_line cache_lines[CONFIG_FS_LITTLEFS_BLOCK_CACHE_LINES];
+static u32_t cache_stamp;
+static K_MUTEX_DEFINE(cache_lock);
+
+static struct lfs_cache_line *cache_find(const struct flash_area *area,
+					 lfs_block_t block, lfs_off_t off)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(cache_lines); i++) {
+		struct lfs_cache_line *line = &cache_lines[i];
+
+		if ((line->area == area) && (line->block == block) &&
+		    (line->off == off)) {
+			return line;
+		}
+	}
+
+	return NULL;
+}
+
+static struct lfs_cache_line *cache_load(struct fs_littlefs *fs,
+					 lfs_block_t block, lfs_off_t off,
+					 int *rc)
+{
+	struct lfs_cache_line *line = &cache_lines[0];
+
+	/* Free line, or the least recently used one */
+	for (size_t i = 0; i < ARRAY_SIZE(cache_lines); i++) {
+		if (cache_lines[i].area == NULL) {
+			line = &cache_lines[i];
+			break;
+		}
+		if ((s32_t)(cache_lines[i].stamp - line->stamp) < 0) {
+			line = &cache_lines[i];
+		}
+	}
+
+	line->area = NULL;
+	*rc = flash_area_read(fs->area, block * fs->cfg.block_size + off,
+			      line->data, CACHE_LINE_SIZE);
+	if (*rc < 0) {
+		return NULL;
+	}
+
+	line->area = fs->area;
+	line->block = block;
+	line->off = off;
+	line->stamp = ++cache_stamp;
+
+	return line;
+}
+
+static void cache_read_ahead(struct fs_littlefs *fs, lfs_block_t block,
+			     lfs_off_t off)
+{
+	int rc;
+
+	for (int i = 0; i < CONFIG_FS_LITTLEFS_BLOCK_CACHE_READ_AHEAD; i++) {
+		if (off >= fs->cfg.block_size) {
+			break;
+		}
+
+		if (!cache_find(fs->area, block, off)) {
+			if (!cache_load(fs, block, off, &rc)) {
+				break;
+			}
+			fs->cache_stats.read_ahead++;
+		}
+
+		off += CACHE_LINE_SIZE;
+	}
+}
+
+static int cache_read(struct fs_littlefs *fs, lfs_block_t block,
+		      lfs_off_t off, u8_t *buf, lfs_size_t size)
+{
+	struct lfs_cache_line *line;
+	lfs_off_t line_off;
+	lfs_size_t len;
+	bool sequential;
+	int rc = 0;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	while (size) {
+		line_off = off - (off % CACHE_LINE_SIZE);
+		len = MIN(size, line_off + CACHE_LINE_SIZE - off);
+
+		sequential = (block == fs->cache_next_block) &&
+			     (line_off == fs->cache_next_off);
+		fs->cache_next_block = block;
+		fs->cache_next_off = line_off + CACHE_LINE_SIZE;
+
+		line = cache_find(fs->area, block, line_off);
+		if (line) {
+			fs->cache_stats.hits++;
+			line->stamp = ++cache_stamp;
+			memcpy(buf, &line->data[off - line_off], len);
+			goto next;
+		}
+
+		fs->cache_stats.misses++;
+
+		if ((off == line_off) && (size >= CACHE_LINE_SIZE)) {
+			/* Whole lines, read them directly into the buffer
+			 * instead of evicting other lines.
+			 */
+			len = size - (size % CACHE_LINE_SIZE);
+			fs->cache_next_off = off + len;
+			rc = flash_area_read(fs->area,
+					     block * fs->cfg.block_size + off,
+					     buf, len);
+			if (rc < 0) {
+				break;
+			}
+			goto next;
+		}
+
+		line = cache_load(fs, block, line_off, &rc);
+		if (!line) {
+			break;
+		}
+		memcpy(buf, &line->data[off - line_off], len);
+
+		if (sequential) {
+			cache_read_ahead(fs, block, line_off + CACHE_LINE_SIZE);
+		}
+next:
+		buf += len;
+		off += len;
+		size -= len;
+	}
+
+	k_mutex_unlock(&cache_lock);
+
+	return rc;
+}
+
+/* Copy programmed data to the cached lines it overlaps, or drop these
+ * lines when buf is NULL.
+ */
+static void cache_update(struct fs_littlefs *fs, lfs_block_t block,
+			 lfs_off_t off, const u8_t *buf, lfs_size_t size)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(cache_lines); i++) {
+		struct lfs_cache_line *line = &cache_lines[i];
+		lfs_off_t start, end;
+
+		if ((line->area != fs->area) || (line->block != block) ||
+		    (line->off >= off + size) ||
+		    (line->off + CACHE_LINE_SIZE <= off)) {
+			continue;
+		}
+
+		if (buf == NULL) {
+			line->area = NULL;
+			continue;
+		}
+
+		start = MAX(off, line->off);
+		end = MIN(off + size, line->off + CACHE_LINE_SIZE);
+		memcpy(&line->data[start - line->off], &buf[start - off],
+		       end - start);
+	}
+
+	k_mutex_unlock(&cache_lock);
+}
+
+static void cache_drop_area(const struct flash_area *area)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(cache_lines); i++) {
+		if (cache_lines[i].area == area) {
+			cache_lines[i].area = NULL;
+		}
+	}
+
+	k_mutex_unlock(&cache_lock);
+}
+
+void fs_littlefs_cache_stats_get(struct fs_littlefs *fs,
+				 struct fs_littlefs_cache_stats *stats)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+	*stats = fs->cache_stats;
+	k_mutex_unlock(&cache_lock);
+}
+#endif /* CONFIG_FS_LITTLEFS_BLOCK_CACHE */
+
 static int lfs_api_read(const struct lfs_config *c, lfs_block_t block,
 			lfs_off_t off, void *buffer, lfs_size_t size)
 {
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size + off;
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	struct fs_littlefs *fs = CONTAINER_OF(c, struct fs_littlefs, cfg);
+
+	if (fs->cache_enabled) {
+		return errno_to_lfs(cache_read(fs, block, off, buffer, size));
+	}
+#endif /* CONFIG_FS_LITTLEFS_BLOCK_CACHE */
+
 	int rc = flash_area_read(fa, offset, buffer, size);
 
 	return errno_to_lfs(rc);
@@ -151,6 +370,15 @@ static int lfs_api_prog(const struct lfs_config *c, lfs_block_t block,
 
 	int rc = flash_area_write(fa, offset, buffer, size);
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	struct fs_littlefs *fs = CONTAINER_OF(c, struct fs_littlefs, cfg);
+
+	if (fs->cache_enabled) {
+		/* On failure the flash content is unknown */
+		cache_update(fs, block, off, (rc < 0) ? NULL : buffer, size);
+	}
+#endif /* CONFIG_FS_LITTLEFS_BLOCK_CACHE */
+
 	return errno_to_lfs(rc);
 }
 
@@ -161,6 +389,14 @@ static int lfs_api_erase(const struct lfs_config *c, lfs_block_t block)
 
 	int rc = flash_area_erase(fa, offset, c->block_size);
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	struct fs_littlefs *fs = CONTAINER_OF(c, struct fs_littlefs, cfg);
+
+	if (fs->cache_enabled) {
+		cache_update(fs, block, 0, NULL, c->block_size);
+	}
+#endif /* CONFIG_FS_LITTLEFS_BLOCK_CACHE */
+
 	return errno_to_lfs(rc);
 }
 
@@ -659,6 +895,19 @@ static int littlefs_mount(struct fs_mount_t *mountp)
 	lcp->cache_size = cache_size;
 	lcp->lookahead_size = lookahead_size;
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	/* The partition may have been written while unmounted */
+	cache_drop_area(fs->area);
+	memset(&fs->cache_stats, 0, sizeof(fs->cache_stats));
+	fs->cache_next_block = 0;
+	fs->cache_next_off = 0;
+	fs->cache_enabled = ((block_size % CACHE_LINE_SIZE) == 0) &&
+			    ((CACHE_LINE_SIZE % read_size) == 0);
+	if (!fs->cache_enabled) {
+		LOG_WRN("block cache line size incompatible, not cached");
+	}
+#endif /* CONFIG_FS_LITTLEFS_BLOCK_CACHE */
+
 	/* Mount it, formatting if needed. */
 	ret = lfs_mount(&fs->lfs, &fs->cfg);
 	if (ret < 0) {
@@ -696,6 +945,9 @@ static int littlefs_unmount(struct fs_mount_t *mountp)
 	fs_lock(fs);
 
 	lfs_unmount(&fs->lfs);
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	cache_drop_area(fs->area);
+#endif /* CONFIG_FS_LITTLEFS_BLOCK_CACHE */
 	flash_area_close(fs->area);
 	fs->area = NULL;
 
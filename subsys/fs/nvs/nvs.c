@@ -6,6 +6,7 @@
  */
 
 #include <drivers/flash.h>
+#include <init.h>
 #include <string.h>
 #include <errno.h>
 #include <inttypes.h>
@@ -431,10 +432,91 @@ static int nvs_sector_close(struct nvs_fs *fs)
 
 	fs->data_wra = fs->ate_wra & ADDR_SECT_MASK;
 
+#if defined(CONFIG_NVS_GC_BACKGROUND)
+	/* the sector to collect in the background has moved on */
+	if (fs->gc_state != NVS_GC_ERASING) {
+		fs->gc_state = NVS_GC_IDLE;
+	}
+#endif /* CONFIG_NVS_GC_BACKGROUND */
+
 	return 0;
 }
 
 
+/* garbage collection of a single ate: the ate at gc_addr is copied to the
+ * write sector if it is the most recent one for its id, gc_addr is moved to
+ * the previous ate and gc_prev_addr is set to the address of the collected
+ * ate. With check_space the copy fails with -ENOSPC instead of overrunning
+ * the write sector.
+ */
+static int nvs_gc_ate(struct nvs_fs *fs, u32_t *gc_addr, u32_t *gc_prev_addr,
+		      bool check_space)
+{
+	int rc;
+	struct nvs_ate gc_ate, wlk_ate;
+	u32_t wlk_addr, wlk_prev_addr, data_addr;
+	size_t ate_size;
+
+	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
+
+	*gc_prev_addr = *gc_addr;
+	rc = nvs_prev_ate(fs, gc_addr, &gc_ate);
+	if (rc) {
+		return rc;
+	}
+	wlk_addr = fs->ate_wra;
+	while (1) {
+		wlk_prev_addr = wlk_addr;
+		rc = nvs_prev_ate(fs, &wlk_addr, &wlk_ate);
+		if (rc) {
+			return rc;
+		}
+		/* if ate with same id is reached we might need to copy.
+		 * only consider valid wlk_ate's. Something wrong might
+		 * have been written that has the same ate but is
+		 * invalid, don't consider these as a match.
+		 */
+		if ((wlk_ate.id == gc_ate.id) &&
+		    (!nvs_ate_crc8_check(&wlk_ate))) {
+			break;
+		}
+		/* an invalid gc_ate is never matched, stop at the end */
+		if (wlk_addr == fs->ate_wra) {
+			break;
+		}
+	}
+	/* if walk has reached the same address as gc_addr copy is
+	 * needed unless it is a deleted item.
+	 */
+	if ((wlk_prev_addr == *gc_prev_addr) && gc_ate.len) {
+		/* copy needed */
+		if (check_space && (fs->ate_wra < fs->data_wra +
+				    nvs_al_size(fs, gc_ate.len) + ate_size)) {
+			return -ENOSPC;
+		}
+
+		LOG_DBG("Moving %d, len %d", gc_ate.id, gc_ate.len);
+
+		data_addr = (*gc_prev_addr & ADDR_SECT_MASK);
+		data_addr += gc_ate.offset;
+
+		gc_ate.offset = (u16_t)(fs->data_wra & ADDR_OFFS_MASK);
+		nvs_ate_crc8_update(&gc_ate);
+
+		rc = nvs_flash_block_move(fs, data_addr, gc_ate.len);
+		if (rc) {
+			return rc;
+		}
+
+		rc = nvs_flash_ate_wrt(fs, &gc_ate);
+		if (rc) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+
 /* garbage collection: the address ate_wra has been updated to the new sector
  * that has just been started. The data to gc is in the sector after this new
  * sector.
@@ -442,9 +524,8 @@ static int nvs_sector_close(struct nvs_fs *fs)
 static int nvs_gc(struct nvs_fs *fs)
 {
 	int rc;
-	struct nvs_ate close_ate, gc_ate, wlk_ate;
-	u32_t sec_addr, gc_addr, gc_prev_addr, wlk_addr, wlk_prev_addr,
-	      data_addr, stop_addr;
+	struct nvs_ate close_ate;
+	u32_t sec_addr, gc_addr, gc_prev_addr, stop_addr;
 	size_t ate_size;
 
 	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
@@ -453,6 +534,23 @@ static int nvs_gc(struct nvs_fs *fs)
 	nvs_sector_advance(fs, &sec_addr);
 	gc_addr = sec_addr + fs->sector_size - ate_size;
 
+#if defined(CONFIG_NVS_GC_BACKGROUND)
+	if (fs->gc_state == NVS_GC_ERASING) {
+		/* wait for the background erase to complete */
+		k_mutex_lock(&fs->gc_erase_lock, K_FOREVER);
+		k_mutex_unlock(&fs->gc_erase_lock);
+	}
+
+	/* the background collection restarts from the new write sector */
+	fs->gc_state = NVS_GC_IDLE;
+
+	if (fs->gc_erased == (sec_addr >> ADDR_SECT_SHIFT) + 1U) {
+		/* already collected and erased in the background */
+		fs->gc_erased = 0U;
+		return 0;
+	}
+#endif /* CONFIG_NVS_GC_BACKGROUND */
+
 	/* if the sector is not closed don't do gc */
 	rc = nvs_flash_ate_rd(fs, gc_addr, &close_ate);
 	if (rc < 0) {
@@ -475,65 +573,169 @@ static int nvs_gc(struct nvs_fs *fs)
 	gc_addr += close_ate.offset;
 
 	while (1) {
-		gc_prev_addr = gc_addr;
-		rc = nvs_prev_ate(fs, &gc_addr, &gc_ate);
+		rc = nvs_gc_ate(fs, &gc_addr, &gc_prev_addr, false);
 		if (rc) {
 			return rc;
 		}
-		wlk_addr = fs->ate_wra;
-		while (1) {
-			wlk_prev_addr = wlk_addr;
-			rc = nvs_prev_ate(fs, &wlk_addr, &wlk_ate);
-			if (rc) {
-				return rc;
-			}
-			/* if ate with same id is reached we might need to copy.
-			 * only consider valid wlk_ate's. Something wrong might
-			 * have been written that has the same ate but is
-			 * invalid, don't consider these as a match.
-			 */
-			if ((wlk_ate.id == gc_ate.id) &&
-			    (!nvs_ate_crc8_check(&wlk_ate))) {
-				break;
-			}
+
+		/* stop gc at end of the sector */
+		if (gc_prev_addr == stop_addr) {
+			break;
 		}
-		/* if walk has reached the same address as gc_addr copy is
-		 * needed unless it is a deleted item.
-		 */
-		if ((wlk_prev_addr == gc_prev_addr) && gc_ate.len) {
-			/* copy needed */
-			LOG_DBG("Moving %d, len %d", gc_ate.id, gc_ate.len);
+	}
 
-			data_addr = (gc_prev_addr & ADDR_SECT_MASK);
-			data_addr += gc_ate.offset;
+	rc = nvs_flash_erase_sector(fs, sec_addr);
+	if (rc) {
+		return rc;
+	}
+	return 0;
+}
 
-			gc_ate.offset = (u16_t)(fs->data_wra & ADDR_OFFS_MASK);
-			nvs_ate_crc8_update(&gc_ate);
+#if defined(CONFIG_NVS_GC_BACKGROUND)
+/* Background garbage collection: the sector following the empty sector
+ * after the write sector is collected ahead of time, one ate or one erase
+ * per work item, so that closing the write sector finds the next gc
+ * already done. Copies made before an interruption are just newer
+ * duplicates, the collection can restart from scratch at any time.
+ */
+static K_THREAD_STACK_DEFINE(nvs_gc_stack,
+			     CONFIG_NVS_GC_BACKGROUND_STACK_SIZE);
+static struct k_work_q nvs_gc_work_q;
 
-			rc = nvs_flash_block_move(fs, data_addr, gc_ate.len);
-			if (rc) {
-				return rc;
-			}
+static int nvs_gc_bg_start(struct nvs_fs *fs, u16_t sector)
+{
+	int rc;
+	struct nvs_ate close_ate;
+	u32_t addr;
+	size_t ate_size;
 
-			rc = nvs_flash_ate_wrt(fs, &gc_ate);
-			if (rc) {
-				return rc;
-			}
+	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
+
+	fs->gc_sector = sector;
+	addr = ((u32_t)sector << ADDR_SECT_SHIFT) + fs->sector_size - ate_size;
+
+	rc = nvs_flash_ate_rd(fs, addr, &close_ate);
+	if (rc) {
+		return rc;
+	}
+
+	rc = nvs_ate_cmp_const(&close_ate, 0xff);
+	if (!rc) {
+		/* sector not closed, nothing to copy */
+		rc = nvs_flash_cmp_const(fs, addr & ADDR_SECT_MASK, 0xff,
+					 fs->sector_size);
+		if (rc < 0) {
+			return rc;
 		}
+		if (!rc) {
+			/* already blank, as on every boot */
+			fs->gc_erased = sector + 1U;
+			fs->gc_state = NVS_GC_IDLE;
+			return 0;
+		}
+		fs->gc_state = NVS_GC_ERASE;
+		return 0;
+	}
 
-		/* stop gc at end of the sector */
-		if (gc_prev_addr == stop_addr) {
-			break;
+	fs->gc_stop_addr = addr - ate_size;
+	fs->gc_addr = (addr & ADDR_SECT_MASK) + close_ate.offset;
+	fs->gc_state = NVS_GC_COPY;
+	return 0;
+}
+
+static void nvs_gc_bg_handler(struct k_work *work)
+{
+	struct nvs_fs *fs = CONTAINER_OF(work, struct nvs_fs, gc_work);
+	u32_t gc_prev_addr;
+	u16_t sector;
+	int rc = 0;
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+
+	/* the sector before the write sector has to stay closed, otherwise
+	 * nvs_startup() can not find the write sector back.
+	 */
+	if (!fs->ready || fs->sector_count < 4) {
+		goto end;
+	}
+
+	sector = ((fs->ate_wra >> ADDR_SECT_SHIFT) + 2U) % fs->sector_count;
+
+	if ((fs->gc_state == NVS_GC_IDLE) || (fs->gc_sector != sector)) {
+		if (fs->gc_erased == sector + 1U) {
+			fs->gc_state = NVS_GC_IDLE;
+			goto end;
+		}
+
+		rc = nvs_gc_bg_start(fs, sector);
+		if (rc || (fs->gc_state == NVS_GC_IDLE)) {
+			goto end;
 		}
 	}
 
-	rc = nvs_flash_erase_sector(fs, sec_addr);
+	if (fs->gc_state == NVS_GC_COPY) {
+		rc = nvs_gc_ate(fs, &fs->gc_addr, &gc_prev_addr, true);
+		if (rc) {
+			/* out of space: left to the next nvs_write() */
+			goto end;
+		}
+		if (gc_prev_addr == fs->gc_stop_addr) {
+			fs->gc_state = NVS_GC_ERASE;
+		}
+	} else {
+		/* the erase is done without nvs_lock so that writes to the
+		 * write sector are not held off meanwhile. The gc state is
+		 * owned by the holder of gc_erase_lock while erasing, nvs_gc()
+		 * waits on it before touching this sector.
+		 */
+		k_mutex_lock(&fs->gc_erase_lock, K_FOREVER);
+		fs->gc_state = NVS_GC_ERASING;
+		k_mutex_unlock(&fs->nvs_lock);
+
+		rc = nvs_flash_erase_sector(fs,
+					    (u32_t)sector << ADDR_SECT_SHIFT);
+		if (rc) {
+			/* left to the next nvs_gc() */
+			LOG_ERR("Background gc failed (err %d)", rc);
+		} else {
+			fs->gc_erased = sector + 1U;
+		}
+		fs->gc_state = NVS_GC_IDLE;
+		k_mutex_unlock(&fs->gc_erase_lock);
+		return;
+	}
+
+	k_mutex_unlock(&fs->nvs_lock);
+
+	/* next step, after anything else queued meanwhile */
+	k_work_submit_to_queue(&nvs_gc_work_q, &fs->gc_work);
+	return;
+
+end:
 	if (rc) {
-		return rc;
+		if (rc != -ENOSPC) {
+			LOG_ERR("Background gc failed (err %d)", rc);
+		}
+		fs->gc_state = NVS_GC_IDLE;
 	}
+	k_mutex_unlock(&fs->nvs_lock);
+}
+
+static int nvs_gc_bg_init(struct device *unused)
+{
+	ARG_UNUSED(unused);
+
+	k_work_q_start(&nvs_gc_work_q, nvs_gc_stack,
+		       K_THREAD_STACK_SIZEOF(nvs_gc_stack),
+		       CONFIG_NVS_GC_BACKGROUND_PRIORITY);
+	k_thread_name_set(&nvs_gc_work_q.thread, "nvs_gc");
+
 	return 0;
 }
 
+SYS_INIT(nvs_gc_bg_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_NVS_GC_BACKGROUND */
+
 static int nvs_startup(struct nvs_fs *fs)
 {
 	int rc;
@@ -685,6 +887,16 @@ int nvs_clear(struct nvs_fs *fs)
 			return rc;
 		}
 	}
+
+#if defined(CONFIG_NVS_GC_BACKGROUND)
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+	k_mutex_lock(&fs->gc_erase_lock, K_FOREVER);
+	fs->gc_state = NVS_GC_IDLE;
+	fs->gc_erased = 0U;
+	k_mutex_unlock(&fs->gc_erase_lock);
+	k_mutex_unlock(&fs->nvs_lock);
+#endif /* CONFIG_NVS_GC_BACKGROUND */
+
 	return 0;
 }
 
@@ -695,6 +907,15 @@ int nvs_init(struct nvs_fs *fs, const char *dev_name)
 	struct flash_pages_info info;
 
 	k_mutex_init(&fs->nvs_lock);
+#if defined(CONFIG_NVS_GC_BACKGROUND)
+	/* the work item of an initialized fs may still be queued */
+	if (!fs->ready) {
+		k_work_init(&fs->gc_work, nvs_gc_bg_handler);
+		k_mutex_init(&fs->gc_erase_lock);
+	}
+	fs->gc_state = NVS_GC_IDLE;
+	fs->gc_erased = 0U;
+#endif /* CONFIG_NVS_GC_BACKGROUND */
 
 	fs->flash_device = device_get_binding(dev_name);
 	if (!fs->flash_device) {
@@ -743,12 +964,16 @@ int nvs_init(struct nvs_fs *fs, const char *dev_name)
 		(fs->data_wra >> ADDR_SECT_SHIFT),
 		(fs->data_wra & ADDR_OFFS_MASK));
 
+#if defined(CONFIG_NVS_GC_BACKGROUND)
+	k_work_submit_to_queue(&nvs_gc_work_q, &fs->gc_work);
+#endif /* CONFIG_NVS_GC_BACKGROUND */
+
 	return 0;
 }
 
 ssize_t nvs_write(struct nvs_fs *fs, u16_t id, const void *data, size_t len)
 {
-	int rc, gc_count;
+	int rc, gc_count = 0;
 	size_t ate_size, data_size;
 	struct nvs_ate wlk_ate;
 	u32_t wlk_addr, rd_addr;
@@ -772,6 +997,9 @@ ssize_t nvs_write(struct nvs_fs *fs, u16_t id, const void *data, size_t len)
 		return -EINVAL;
 	}
 
+	/* the background gc moves ate_wra, hold the lock while walking */
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+
 	/* find latest entry with same id */
 	wlk_addr = fs->ate_wra;
 	rd_addr = wlk_addr;
@@ -780,7 +1008,7 @@ ssize_t nvs_write(struct nvs_fs *fs, u16_t id, const void *data, size_t len)
 		rd_addr = wlk_addr;
 		rc = nvs_prev_ate(fs, &wlk_addr, &wlk_ate);
 		if (rc) {
-			return rc;
+			goto end;
 		}
 		if ((wlk_ate.id == id) && (!nvs_ate_crc8_check(&wlk_ate))) {
 			prev_found = true;
@@ -802,20 +1030,22 @@ ssize_t nvs_write(struct nvs_fs *fs, u16_t id, const void *data, size_t len)
 				/* skip delete entry as it is already the
 				 * last one
 				 */
-				return 0;
+				rc = 0;
+				goto end;
 			}
 		} else if (len == wlk_ate.len) {
 			/* do not try to compare if lengths are not equal */
 			/* compare the data and if equal return 0 */
 			rc = nvs_flash_block_cmp(fs, rd_addr, data, len);
 			if (rc <= 0) {
-				return rc;
+				goto end;
 			}
 		}
 	} else {
 		/* skip delete entry for non-existing entry */
 		if (len == 0) {
-			return 0;
+			rc = 0;
+			goto end;
 		}
 	}
 
@@ -825,8 +1055,6 @@ ssize_t nvs_write(struct nvs_fs *fs, u16_t id, const void *data, size_t len)
 		required_space = data_size + ate_size;
 	}
 
-	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
-
 	gc_count = 0;
 	while (1) {
 		if (gc_count == fs->sector_count) {
@@ -860,6 +1088,12 @@ ssize_t nvs_write(struct nvs_fs *fs, u16_t id, const void *data, size_t len)
 	}
 	rc = len;
 end:
+#if defined(CONFIG_NVS_GC_BACKGROUND)
+	if (gc_count) {
+		/* a new sector was started, prepare the next one */
+		k_work_submit_to_queue(&nvs_gc_work_q, &fs->gc_work);
+	}
+#endif /* CONFIG_NVS_GC_BACKGROUND */
 	k_mutex_unlock(&fs->nvs_lock);
 	return rc;
 }
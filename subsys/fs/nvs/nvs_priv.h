@@ -28,6 +28,16 @@ extern "C" {
 
 #define NVS_BLOCK_SIZE 32
 
+/*
+ * Background garbage collection states
+ */
+enum {
+	NVS_GC_IDLE,	/* nothing in progress */
+	NVS_GC_COPY,	/* copying the ates of gc_sector */
+	NVS_GC_ERASE,	/* gc_sector is to be erased */
+	NVS_GC_ERASING,	/* erasing gc_sector without nvs_lock */
+};
+
 /* Allocation Table Entry */
 struct nvs_ate {
 	u16_t id;	/* data id */
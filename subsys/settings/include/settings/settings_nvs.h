@@ -38,6 +38,19 @@ struct settings_nvs {
 	struct nvs_fs cf_nvs;
 	u16_t last_name_id;
 	const char *flash_dev_name;
+#if defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+	/* Open addressing hash table of name IDs, 0 marks a free slot */
+	struct settings_nvs_cache_entry {
+		u16_t name_hash;
+		u16_t name_id;
+	} cache[CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE];
+	u16_t cache_cnt;
+	/* Lowest name ID known to be free, NVS_NAMECNT_ID if none */
+	u16_t free_name_id;
+	/* Every name stored in NVS is in the cache */
+	bool cache_loaded;
+	bool cache_overflow;
+#endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
 };
 
 /* register nvs to be a source of settings */
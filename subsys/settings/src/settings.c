@@ -24,6 +24,132 @@ sys_slist_t settings_handlers;
 
 K_MUTEX_DEFINE(settings_lock);
 
+#if CONFIG_SETTINGS_HANDLER_INDEX_SIZE > 0
+/*
+ * Hash index over the handler names. Lookups hash every prefix of the item
+ * name ending at a separator, which gives the longest match in a single pass
+ * over the name whatever the number of handlers.
+ */
+static struct {
+	u32_t hash;
+	struct settings_handler_static *handler;
+} settings_index[CONFIG_SETTINGS_HANDLER_INDEX_SIZE];
+static u16_t settings_index_cnt;
+static bool settings_index_ready;
+
+static inline u32_t settings_index_hash(u32_t hash, char c)
+{
+	/* FNV-1a */
+	return (hash ^ (u8_t)c) * 16777619U;
+}
+
+#define SETTINGS_INDEX_HASH_INIT 2166136261U
+
+static void settings_index_add(struct settings_handler_static *handler)
+{
+	const char *c;
+	u32_t hash = SETTINGS_INDEX_HASH_INIT;
+	u16_t i;
+
+	for (c = handler->name; *c; c++) {
+		hash = settings_index_hash(hash, *c);
+	}
+
+	i = hash % ARRAY_SIZE(settings_index);
+	while (settings_index[i].handler) {
+		/* Same name registered again, the last one wins as in a
+		 * linear search.
+		 */
+		if ((settings_index[i].hash == hash) &&
+		    !strcmp(settings_index[i].handler->name, handler->name)) {
+			settings_index[i].handler = handler;
+			return;
+		}
+
+		i = (i + 1) % ARRAY_SIZE(settings_index);
+	}
+
+	/* Keep one free slot to terminate the lookups */
+	if (settings_index_cnt >= (ARRAY_SIZE(settings_index) - 1)) {
+		LOG_WRN("Handler index full, using linear lookup");
+		settings_index_ready = false;
+		return;
+	}
+
+	settings_index[i].hash = hash;
+	settings_index[i].handler = handler;
+	settings_index_cnt++;
+}
+
+static struct settings_handler_static *settings_index_find(const char *name,
+							   size_t len,
+							   u32_t hash)
+{
+	u16_t i = hash % ARRAY_SIZE(settings_index);
+
+	for (; settings_index[i].handler;
+	     i = (i + 1) % ARRAY_SIZE(settings_index)) {
+		struct settings_handler_static *ch = settings_index[i].handler;
+
+		if ((settings_index[i].hash == hash) &&
+		    !strncmp(ch->name, name, len) && (ch->name[len] == '\0')) {
+			return ch;
+		}
+	}
+
+	return NULL;
+}
+
+static struct settings_handler_static *settings_index_lookup(const char *name,
+							     const char **next)
+{
+	struct settings_handler_static *bestmatch = NULL;
+	struct settings_handler_static *ch;
+	u32_t hash = SETTINGS_INDEX_HASH_INIT;
+	const char *c;
+
+	for (c = name; ; c++) {
+		bool last = (*c == SETTINGS_NAME_END) || (*c == '\0');
+
+		if (last || (*c == SETTINGS_NAME_SEPARATOR)) {
+			ch = settings_index_find(name, c - name, hash);
+			if (ch) {
+				bestmatch = ch;
+				if (next) {
+					*next = last ? NULL : (c + 1);
+				}
+			}
+
+			if (last) {
+				break;
+			}
+		}
+
+		hash = settings_index_hash(hash, *c);
+	}
+
+	return bestmatch;
+}
+
+static void settings_index_init(void)
+{
+	(void)memset(settings_index, 0, sizeof(settings_index));
+	settings_index_cnt = 0U;
+	settings_index_ready = true;
+
+	Z_STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
+		settings_index_add(ch);
+	}
+
+#if defined(CONFIG_SETTINGS_DYNAMIC_HANDLERS)
+	struct settings_handler *ch;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&settings_handlers, ch, node) {
+		settings_index_add((struct settings_handler_static *)ch);
+	}
+#endif /* CONFIG_SETTINGS_DYNAMIC_HANDLERS */
+}
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX_SIZE > 0 */
 
 void settings_store_init(void);
 
@@ -32,6 +158,9 @@ void settings_init(void)
 #if defined(CONFIG_SETTINGS_DYNAMIC_HANDLERS)
 	sys_slist_init(&settings_handlers);
 #endif /* CONFIG_SETTINGS_DYNAMIC_HANDLERS */
+#if CONFIG_SETTINGS_HANDLER_INDEX_SIZE > 0
+	settings_index_init();
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX_SIZE > 0 */
 	settings_store_init();
 }
 
@@ -57,6 +186,11 @@ int settings_register(struct settings_handler *handler)
 		}
 	}
 	sys_slist_append(&settings_handlers, &handler->node);
+#if CONFIG_SETTINGS_HANDLER_INDEX_SIZE > 0
+	if (settings_index_ready) {
+		settings_index_add((struct settings_handler_static *)handler);
+	}
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX_SIZE > 0 */
 	rc = 0;
 end:
 	k_mutex_unlock(&settings_lock);
@@ -146,6 +280,12 @@ struct settings_handler_static *settings_parse_and_lookup(const char *name,
 		*next = NULL;
 	}
 
+#if CONFIG_SETTINGS_HANDLER_INDEX_SIZE > 0
+	if (settings_index_ready) {
+		return settings_index_lookup(name, next);
+	}
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX_SIZE > 0 */
+
 	Z_STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
 		if (!settings_name_steq(name, ch->name, &tmpnext)) {
 			continue;
@@ -240,7 +380,8 @@ int settings_commit_subtree(const char *subtree)
 	int rc;
 	int rc2;
 
-	rc = 0;
+	/* Handlers may rely on the committed values being persistent */
+	rc = settings_flush();
 
 	Z_STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
 		if (subtree && !settings_name_steq(ch->name, subtree, NULL)) {
@@ -119,6 +119,140 @@ static int read_entry_len(const struct fcb_entry_ctx *entry_ctx, off_t off)
 	return entry_ctx->loc.fe_data_len - off;
 }
 
+#if CONFIG_SETTINGS_FCB_LOAD_NAMES > 0
+/*
+ * Newest record of each setting name, tracked by a first pass over the FCB
+ * so that stale records can be told apart without rescanning the remainder
+ * of the FCB for every record. Names whose hash collides with a different
+ * name, or which do not fit in the table, fall back to the rescan.
+ */
+static struct settings_fcb_name {
+	u32_t hash;
+	bool collision;
+	struct fcb_entry loc;
+} settings_fcb_names[CONFIG_SETTINGS_FCB_LOAD_NAMES];
+
+static u32_t settings_fcb_name_hash(const char *name)
+{
+	/* FNV-1a */
+	u32_t hash = 2166136261U;
+
+	while (*name) {
+		hash ^= (u8_t)*name++;
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
+
+static struct settings_fcb_name *settings_fcb_name_find(u32_t hash,
+							bool alloc)
+{
+	struct settings_fcb_name *n;
+	u32_t idx = hash % ARRAY_SIZE(settings_fcb_names);
+	u32_t i;
+
+	for (i = 0; i < ARRAY_SIZE(settings_fcb_names); i++) {
+		n = &settings_fcb_names[idx];
+
+		if (!n->loc.fe_sector) {
+			if (!alloc) {
+				return NULL;
+			}
+
+			n->hash = hash;
+			return n;
+		}
+
+		if (n->hash == hash) {
+			return n;
+		}
+
+		idx = (idx + 1) % ARRAY_SIZE(settings_fcb_names);
+	}
+
+	return NULL;
+}
+
+static void settings_fcb_names_build(struct settings_fcb *cf)
+{
+	struct fcb_entry_ctx entry_ctx = {
+		{.fe_sector = NULL, .fe_elem_off = 0},
+		.fap = cf->cf_fcb.fap
+	};
+
+	(void)memset(settings_fcb_names, 0, sizeof(settings_fcb_names));
+
+	while (fcb_getnext(&cf->cf_fcb, &entry_ctx.loc) == 0) {
+		char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+		char name2[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+		struct fcb_entry_ctx entry2_ctx;
+		struct settings_fcb_name *n;
+		size_t name_len;
+		size_t name2_len;
+
+		if (settings_line_name_read(name, sizeof(name), &name_len,
+					    &entry_ctx)) {
+			continue;
+		}
+		name[name_len] = '\0';
+
+		n = settings_fcb_name_find(settings_fcb_name_hash(name), true);
+		if (!n || n->collision) {
+			continue;
+		}
+
+		if (n->loc.fe_sector) {
+			/* Same hash seen before, make sure it is the same
+			 * name before tracking this record as its newest.
+			 */
+			entry2_ctx.loc = n->loc;
+			entry2_ctx.fap = entry_ctx.fap;
+
+			if (settings_line_name_read(name2, sizeof(name2),
+						    &name2_len, &entry2_ctx)) {
+				n->collision = true;
+				continue;
+			}
+			name2[name2_len] = '\0';
+
+			if (strcmp(name, name2)) {
+				n->collision = true;
+				continue;
+			}
+		}
+
+		n->loc = entry_ctx.loc;
+	}
+}
+
+static bool settings_fcb_is_stale(struct settings_fcb *cf,
+				  const struct fcb_entry_ctx *entry_ctx,
+				  const char * const name)
+{
+	struct settings_fcb_name *n;
+
+	n = settings_fcb_name_find(settings_fcb_name_hash(name), false);
+	if (!n || n->collision) {
+		return settings_fcb_check_duplicate(cf, entry_ctx, name);
+	}
+
+	return (n->loc.fe_sector != entry_ctx->loc.fe_sector) ||
+	       (n->loc.fe_elem_off != entry_ctx->loc.fe_elem_off);
+}
+#else /* CONFIG_SETTINGS_FCB_LOAD_NAMES == 0 */
+static inline void settings_fcb_names_build(struct settings_fcb *cf)
+{
+}
+
+static inline bool settings_fcb_is_stale(struct settings_fcb *cf,
+					 const struct fcb_entry_ctx *entry_ctx,
+					 const char * const name)
+{
+	return settings_fcb_check_duplicate(cf, entry_ctx, name);
+}
+#endif /* CONFIG_SETTINGS_FCB_LOAD_NAMES > 0 */
+
 static int settings_fcb_load_priv(struct settings_store *cs,
 				  line_load_cb cb,
 				  void *cb_arg,
@@ -131,6 +265,10 @@ static int settings_fcb_load_priv(struct settings_store *cs,
 	};
 	int rc;
 
+	if (filter_duplicates) {
+		settings_fcb_names_build(cf);
+	}
+
 	while ((rc = fcb_getnext(&cf->cf_fcb, &entry_ctx.loc)) == 0) {
 		char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
 		size_t name_len;
@@ -147,7 +285,7 @@ static int settings_fcb_load_priv(struct settings_store *cs,
 
 		if (filter_duplicates &&
 		    (!read_entry_len(&entry_ctx, name_len+1) ||
-		     settings_fcb_check_duplicate(cf, &entry_ctx, name))) {
+		     settings_fcb_is_stale(cf, &entry_ctx, name))) {
 			pass_entry = false;
 		}
 		/*name, val-read_cb-ctx, val-off*/
@@ -24,10 +24,18 @@ static int settings_nvs_load(struct settings_store *cs,
 			     const struct settings_load_arg *arg);
 static int settings_nvs_save(struct settings_store *cs, const char *name,
 			     const char *value, size_t val_len);
+#if defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+static ssize_t settings_nvs_load_one(struct settings_store *cs,
+				     const char *name, char *buf,
+				     size_t buf_len);
+#endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
 
 static struct settings_store_itf settings_nvs_itf = {
 	.csi_load = settings_nvs_load,
 	.csi_save = settings_nvs_save,
+#if defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+	.csi_load_one = settings_nvs_load_one,
+#endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
 };
 
 static ssize_t settings_nvs_read_fn(void *back_end, void *data, size_t len)
@@ -63,6 +71,208 @@ int settings_nvs_dst(struct settings_nvs *cf)
 	return 0;
 }
 
+#if defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+#define CACHE_SIZE CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE
+
+static u16_t settings_nvs_name_hash(const char *name)
+{
+	/* FNV-1a, folded to 16 bits */
+	u32_t hash = 2166136261U;
+
+	while (*name) {
+		hash ^= (u8_t)*name++;
+		hash *= 16777619U;
+	}
+
+	return (hash >> 16) ^ (hash & 0xffff);
+}
+
+static void settings_nvs_cache_reset(struct settings_nvs *cf)
+{
+	(void)memset(cf->cache, 0, sizeof(cf->cache));
+	cf->cache_cnt = 0U;
+	cf->free_name_id = NVS_NAMECNT_ID;
+	cf->cache_loaded = false;
+	cf->cache_overflow = false;
+}
+
+static bool settings_nvs_cache_ready(struct settings_nvs *cf)
+{
+	return cf->cache_loaded && !cf->cache_overflow;
+}
+
+static void settings_nvs_cache_add(struct settings_nvs *cf, const char *name,
+				   u16_t name_id)
+{
+	u16_t hash = settings_nvs_name_hash(name);
+	u16_t i = hash % CACHE_SIZE;
+
+	/* Keep one free slot to terminate the lookups */
+	if (cf->cache_cnt >= (CACHE_SIZE - 1)) {
+		cf->cache_overflow = true;
+		return;
+	}
+
+	while (cf->cache[i].name_id) {
+		i = (i + 1) % CACHE_SIZE;
+	}
+
+	cf->cache[i].name_hash = hash;
+	cf->cache[i].name_id = name_id;
+	cf->cache_cnt++;
+}
+
+static void settings_nvs_cache_del(struct settings_nvs *cf, const char *name,
+				   u16_t name_id)
+{
+	u16_t hash = settings_nvs_name_hash(name);
+	u16_t i = hash % CACHE_SIZE;
+	u16_t j, k;
+
+	while (cf->cache[i].name_id != name_id) {
+		if (!cf->cache[i].name_id) {
+			return;
+		}
+
+		i = (i + 1) % CACHE_SIZE;
+	}
+
+	/* Shift back the following entries of the cluster which would not
+	 * be found anymore once this slot is freed.
+	 */
+	j = i;
+	while (1) {
+		j = (j + 1) % CACHE_SIZE;
+		if (!cf->cache[j].name_id) {
+			break;
+		}
+
+		k = cf->cache[j].name_hash % CACHE_SIZE;
+		if ((i <= j) ? ((i < k) && (k <= j)) : ((i < k) || (k <= j))) {
+			continue;
+		}
+
+		cf->cache[i] = cf->cache[j];
+		i = j;
+	}
+
+	cf->cache[i].name_id = 0U;
+	cf->cache_cnt--;
+
+	if ((cf->free_name_id == NVS_NAMECNT_ID) ||
+	    (name_id < cf->free_name_id)) {
+		cf->free_name_id = name_id;
+	}
+}
+
+/* Sets free_name_id to the lowest name ID above name_id which is not in use,
+ * only IDs up to last_name_id are holes.
+ */
+static void settings_nvs_cache_next_free(struct settings_nvs *cf,
+					 u16_t name_id)
+{
+	u16_t i;
+
+	for (name_id++; name_id <= cf->last_name_id; name_id++) {
+		for (i = 0U; i < CACHE_SIZE; i++) {
+			if (cf->cache[i].name_id == name_id) {
+				break;
+			}
+		}
+
+		if (i == CACHE_SIZE) {
+			cf->free_name_id = name_id;
+			return;
+		}
+	}
+
+	cf->free_name_id = NVS_NAMECNT_ID;
+}
+
+/* Returns the name ID of name, or NVS_NAMECNT_ID if it is not stored */
+static u16_t settings_nvs_cache_match(struct settings_nvs *cf,
+				      const char *name)
+{
+	char rdname[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+	u16_t hash = settings_nvs_name_hash(name);
+	u16_t i = hash % CACHE_SIZE;
+	ssize_t rc;
+
+	for (; cf->cache[i].name_id; i = (i + 1) % CACHE_SIZE) {
+		if (cf->cache[i].name_hash != hash) {
+			continue;
+		}
+
+		rc = nvs_read(&cf->cf_nvs, cf->cache[i].name_id, &rdname,
+			      sizeof(rdname));
+		if (rc <= 0) {
+			continue;
+		}
+
+		rdname[MIN((size_t)rc, sizeof(rdname) - 1)] = '\0';
+		if (!strcmp(name, rdname)) {
+			return cf->cache[i].name_id;
+		}
+	}
+
+	return NVS_NAMECNT_ID;
+}
+
+static void settings_nvs_cache_build(struct settings_nvs *cf)
+{
+	char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+	u16_t name_id;
+	ssize_t rc;
+
+	settings_nvs_cache_reset(cf);
+
+	for (name_id = cf->last_name_id; name_id > NVS_NAMECNT_ID; name_id--) {
+		rc = nvs_read(&cf->cf_nvs, name_id, &name, sizeof(name));
+		if (rc <= 0) {
+			cf->free_name_id = name_id;
+			continue;
+		}
+
+		name[MIN((size_t)rc, sizeof(name) - 1)] = '\0';
+		settings_nvs_cache_add(cf, name, name_id);
+	}
+
+	cf->cache_loaded = true;
+}
+
+static ssize_t settings_nvs_load_one(struct settings_store *cs,
+				     const char *name, char *buf,
+				     size_t buf_len)
+{
+	struct settings_nvs *cf = (struct settings_nvs *)cs;
+	u16_t name_id;
+	ssize_t rc;
+
+	if (!cf->cache_loaded) {
+		settings_nvs_cache_build(cf);
+	}
+
+	if (cf->cache_overflow) {
+		return -ENOTSUP;
+	}
+
+	name_id = settings_nvs_cache_match(cf, name);
+	if (name_id == NVS_NAMECNT_ID) {
+		return -ENOENT;
+	}
+
+	rc = nvs_read(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET, buf, buf_len);
+	if (rc > (ssize_t)buf_len) {
+		/* nvs_read signals that not all bytes were read
+		 * align read len to what was requested
+		 */
+		rc = buf_len;
+	}
+
+	return rc;
+}
+#endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
+
 static int settings_nvs_load(struct settings_store *cs,
 			     const struct settings_load_arg *arg)
 {
@@ -73,6 +283,13 @@ static int settings_nvs_load(struct settings_store *cs,
 	char buf;
 	ssize_t rc1, rc2;
 	u16_t name_id = NVS_NAMECNT_ID;
+#if defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+	bool cache_fill = !cf->cache_loaded;
+
+	if (cache_fill) {
+		settings_nvs_cache_reset(cf);
+	}
+#endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
 
 	name_id = cf->last_name_id + 1;
 
@@ -92,6 +309,11 @@ static int settings_nvs_load(struct settings_store *cs,
 			       &buf, sizeof(buf));
 
 		if ((rc1 <= 0) && (rc2 <= 0)) {
+#if defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+			if (cache_fill) {
+				cf->free_name_id = name_id;
+			}
+#endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
 			continue;
 		}
 
@@ -108,11 +330,21 @@ static int settings_nvs_load(struct settings_store *cs,
 			}
 			nvs_delete(&cf->cf_nvs, name_id);
 			nvs_delete(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET);
+#if defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+			if (cache_fill) {
+				cf->free_name_id = name_id;
+			}
+#endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
 			continue;
 		}
 
 		/* Found a name, this might not include a trailing \0 */
 		name[rc1] = '\0';
+#if defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+		if (cache_fill) {
+			settings_nvs_cache_add(cf, name, name_id);
+		}
+#endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
 		read_fn_arg.fs = &cf->cf_nvs;
 		read_fn_arg.id = name_id + NVS_NAME_ID_OFFSET;
 
@@ -124,6 +356,14 @@ static int settings_nvs_load(struct settings_store *cs,
 			break;
 		}
 	}
+
+#if defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+	/* Only complete if all names were visited */
+	if (cache_fill && !ret) {
+		cf->cache_loaded = true;
+	}
+#endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
+
 	return ret;
 }
 
@@ -132,7 +372,7 @@ static int settings_nvs_save(struct settings_store *cs, const char *name,
 {
 	struct settings_nvs *cf = (struct settings_nvs *)cs;
 	char rdname[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
-	u16_t name_id, write_name_id;
+	u16_t name_id, write_name_id, found_id;
 	bool delete, write_name;
 	int rc = 0;
 
@@ -143,31 +383,55 @@ static int settings_nvs_save(struct settings_store *cs, const char *name,
 	/* Find out if we are doing a delete */
 	delete = ((value == NULL) || (val_len == 0));
 
-	name_id = cf->last_name_id + 1;
+	found_id = NVS_NAMECNT_ID;
 	write_name_id = cf->last_name_id + 1;
 	write_name = true;
 
-	while (1) {
-		name_id--;
-		if (name_id == NVS_NAMECNT_ID) {
-			break;
+#if defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+	if (!cf->cache_loaded) {
+		settings_nvs_cache_build(cf);
+	}
+
+	if (settings_nvs_cache_ready(cf)) {
+		found_id = settings_nvs_cache_match(cf, name);
+
+		if ((cf->free_name_id != NVS_NAMECNT_ID) &&
+		    (cf->free_name_id < write_name_id)) {
+			write_name_id = cf->free_name_id;
 		}
+	} else
+#endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
+	{
+		name_id = cf->last_name_id + 1;
+
+		while (1) {
+			name_id--;
+			if (name_id == NVS_NAMECNT_ID) {
+				break;
+			}
 
-		rc = nvs_read(&cf->cf_nvs, name_id, &rdname, sizeof(rdname));
+			rc = nvs_read(&cf->cf_nvs, name_id, &rdname,
+				      sizeof(rdname));
 
-		if (rc < 0) {
-			/* Error or entry not found */
-			if (rc == -ENOENT) {
-				write_name_id = name_id;
+			if (rc < 0) {
+				/* Error or entry not found */
+				if (rc == -ENOENT) {
+					write_name_id = name_id;
+				}
+				continue;
 			}
-			continue;
-		}
 
-		rdname[rc] = '\0';
+			rdname[rc] = '\0';
 
-		if (strcmp(name, rdname)) {
-			continue;
+			if (!strcmp(name, rdname)) {
+				found_id = name_id;
+				break;
+			}
 		}
+	}
+
+	if (found_id != NVS_NAMECNT_ID) {
+		name_id = found_id;
 
 		if ((delete) && (name_id == cf->last_name_id)) {
 			cf->last_name_id--;
@@ -193,11 +457,14 @@ static int settings_nvs_save(struct settings_store *cs, const char *name,
 				return rc;
 			}
 
+#if defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+			settings_nvs_cache_del(cf, name, name_id);
+#endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
+
 			return 0;
 		}
 		write_name_id = name_id;
 		write_name = false;
-		break;
 	}
 
 	if (delete) {
@@ -219,6 +486,14 @@ static int settings_nvs_save(struct settings_store *cs, const char *name,
 		if (rc < 0) {
 			return rc;
 		}
+
+#if defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+		settings_nvs_cache_add(cf, name, write_name_id);
+
+		if (write_name_id == cf->free_name_id) {
+			settings_nvs_cache_next_free(cf, write_name_id);
+		}
+#endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
 	}
 
 	/* update the last_name_id and write to flash if required*/
@@ -254,6 +529,10 @@ int settings_nvs_backend_init(struct settings_nvs *cf)
 		cf->last_name_id = last_name_id;
 	}
 
+#if defined(CONFIG_SETTINGS_NVS_NAME_CACHE)
+	settings_nvs_cache_reset(cf);
+#endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
+
 	LOG_DBG("Initialized");
 	return 0;
 }
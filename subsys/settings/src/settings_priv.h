@@ -120,6 +120,13 @@ void settings_line_io_init(int (*read_cb)(void *ctx, off_t off, char *buf,
 			  size_t (*get_len_cb)(void *ctx),
 			  u8_t io_rwbs);
 
+#if defined(CONFIG_SETTINGS_WRITE_CACHE)
+/* Must be called with settings_lock held */
+int settings_write_cache_save(struct settings_store *cs, const char *name,
+			      const char *value, size_t val_len);
+int settings_write_cache_flush(void);
+void settings_write_cache_init(void);
+#endif /* CONFIG_SETTINGS_WRITE_CACHE */
 
 extern sys_slist_t settings_load_srcs;
 extern sys_slist_t settings_handlers;
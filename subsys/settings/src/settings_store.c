@@ -62,6 +62,14 @@ int settings_load_subtree(const char *subtree)
 	 *    commit all
 	 */
 	k_mutex_lock(&settings_lock, K_FOREVER);
+#if defined(CONFIG_SETTINGS_WRITE_CACHE)
+	/* Do not load values older than the ones saved */
+	rc = settings_write_cache_flush();
+	if (rc) {
+		k_mutex_unlock(&settings_lock);
+		return rc;
+	}
+#endif /* CONFIG_SETTINGS_WRITE_CACHE */
 	SYS_SLIST_FOR_EACH_CONTAINER(&settings_load_srcs, cs, cs_next) {
 		cs->cs_itf->csi_load(cs, &arg);
 	}
@@ -76,6 +84,7 @@ int settings_load_subtree_direct(
 	void                   *param)
 {
 	struct settings_store *cs;
+	int rc = 0;
 
 	const struct settings_load_arg arg = {
 		.subtree = subtree,
@@ -89,13 +98,92 @@ int settings_load_subtree_direct(
 	 *    commit all
 	 */
 	k_mutex_lock(&settings_lock, K_FOREVER);
+#if defined(CONFIG_SETTINGS_WRITE_CACHE)
+	rc = settings_write_cache_flush();
+	if (rc) {
+		k_mutex_unlock(&settings_lock);
+		return rc;
+	}
+#endif /* CONFIG_SETTINGS_WRITE_CACHE */
 	SYS_SLIST_FOR_EACH_CONTAINER(&settings_load_srcs, cs, cs_next) {
 		cs->cs_itf->csi_load(cs, &arg);
 	}
 	k_mutex_unlock(&settings_lock);
+	return rc;
+}
+
+struct settings_load_one_arg {
+	void *buf;
+	size_t buf_len;
+	ssize_t rc;
+};
+
+static int settings_load_one_cb(const char *key, size_t len,
+				settings_read_cb read_cb, void *cb_arg,
+				void *param)
+{
+	struct settings_load_one_arg *arg = param;
+
+	/* Skip the items below the requested one */
+	if (key) {
+		return 0;
+	}
+
+	/* Some backends pass old values first, keep the last one */
+	arg->rc = read_cb(cb_arg, arg->buf, arg->buf_len);
+
 	return 0;
 }
 
+ssize_t settings_load_one(const char *name, void *buf, size_t buf_len)
+{
+	struct settings_store *cs;
+	struct settings_load_one_arg one_arg = {
+		.buf = buf,
+		.buf_len = buf_len,
+		.rc = -ENOENT,
+	};
+	const struct settings_load_arg arg = {
+		.subtree = name,
+		.cb = settings_load_one_cb,
+		.param = &one_arg,
+	};
+	ssize_t rc = -ENOENT;
+
+	k_mutex_lock(&settings_lock, K_FOREVER);
+#if defined(CONFIG_SETTINGS_WRITE_CACHE)
+	rc = settings_write_cache_flush();
+	if (rc) {
+		k_mutex_unlock(&settings_lock);
+		return rc;
+	}
+	rc = -ENOENT;
+#endif /* CONFIG_SETTINGS_WRITE_CACHE */
+	SYS_SLIST_FOR_EACH_CONTAINER(&settings_load_srcs, cs, cs_next) {
+		if (cs->cs_itf->csi_load_one) {
+			ssize_t rc2;
+
+			rc2 = cs->cs_itf->csi_load_one(cs, name, buf, buf_len);
+			if (rc2 != -ENOTSUP) {
+				/* Later sources override earlier ones */
+				if (rc2 != -ENOENT) {
+					rc = rc2;
+				}
+				continue;
+			}
+		}
+
+		one_arg.rc = -ENOENT;
+		cs->cs_itf->csi_load(cs, &arg);
+		if (one_arg.rc != -ENOENT) {
+			rc = one_arg.rc;
+		}
+	}
+	k_mutex_unlock(&settings_lock);
+
+	return rc;
+}
+
 /*
  * Append a single value to persisted config. Don't store duplicate value.
  */
@@ -111,7 +199,11 @@ int settings_save_one(const char *name, const void *value, size_t val_len)
 
 	k_mutex_lock(&settings_lock, K_FOREVER);
 
+#if defined(CONFIG_SETTINGS_WRITE_CACHE)
+	rc = settings_write_cache_save(cs, name, (char *)value, val_len);
+#else
 	rc = cs->cs_itf->csi_save(cs, name, (char *)value, val_len);
+#endif /* CONFIG_SETTINGS_WRITE_CACHE */
 
 	k_mutex_unlock(&settings_lock);
 
@@ -123,6 +215,21 @@ int settings_delete(const char *name)
 	return settings_save_one(name, NULL, 0);
 }
 
+int settings_flush(void)
+{
+#if defined(CONFIG_SETTINGS_WRITE_CACHE)
+	int rc;
+
+	k_mutex_lock(&settings_lock, K_FOREVER);
+	rc = settings_write_cache_flush();
+	k_mutex_unlock(&settings_lock);
+
+	return rc;
+#else
+	return 0;
+#endif /* CONFIG_SETTINGS_WRITE_CACHE */
+}
+
 int settings_save(void)
 {
 	struct settings_store *cs;
@@ -160,6 +267,11 @@ int settings_save(void)
 	}
 #endif /* CONFIG_SETTINGS_DYNAMIC_HANDLERS */
 
+	rc2 = settings_flush();
+	if (!rc) {
+		rc = rc2;
+	}
+
 	if (cs->cs_itf->csi_save_end) {
 		cs->cs_itf->csi_save_end(cs);
 	}
@@ -169,4 +281,7 @@ int settings_save(void)
 void settings_store_init(void)
 {
 	sys_slist_init(&settings_load_srcs);
+#if defined(CONFIG_SETTINGS_WRITE_CACHE)
+	settings_write_cache_init();
+#endif /* CONFIG_SETTINGS_WRITE_CACHE */
 }
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/types.h>
+#include <stddef.h>
+#include <errno.h>
+#include <kernel.h>
+
+#include "settings/settings.h"
+#include "settings_priv.h"
+
+#include <logging/log.h>
+LOG_MODULE_DECLARE(settings, CONFIG_SETTINGS_LOG_LEVEL);
+
+extern struct k_mutex settings_lock;
+
+/*
+ * Values saved with settings_save_one() are held in RAM and only written to
+ * the storage when the flush timeout expires, the cache is full, or someone
+ * needs to see the storage content (load, commit, explicit flush). Saving
+ * the same name again before that replaces the cached value, so only the
+ * last one reaches the flash. Entries are kept in the order they were first
+ * saved and written out in that order.
+ */
+struct settings_write_cache_entry {
+	char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+	u8_t value[CONFIG_SETTINGS_WRITE_CACHE_VALUE_SIZE];
+	u16_t val_len; /* 0 for a pending delete */
+};
+
+static struct settings_write_cache_entry
+	cache[CONFIG_SETTINGS_WRITE_CACHE_ENTRIES];
+static u16_t cache_cnt;
+
+static struct settings_write_cache_stats cache_stats;
+static struct k_delayed_work flush_work;
+
+static struct settings_write_cache_entry *cache_find(const char *name)
+{
+	for (int i = 0; i < cache_cnt; i++) {
+		if (!strcmp(cache[i].name, name)) {
+			return &cache[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void cache_remove(struct settings_write_cache_entry *entry)
+{
+	int idx = entry - cache;
+
+	cache_cnt--;
+	memmove(&cache[idx], &cache[idx + 1],
+		(cache_cnt - idx) * sizeof(cache[0]));
+}
+
+int settings_write_cache_flush(void)
+{
+	struct settings_store *cs;
+	int rc = 0;
+	int i;
+
+	cs = settings_save_dst;
+	if (!cs || !cache_cnt) {
+		return 0;
+	}
+
+	for (i = 0; i < cache_cnt; i++) {
+		struct settings_write_cache_entry *entry = &cache[i];
+
+		rc = cs->cs_itf->csi_save(cs, entry->name,
+					  entry->val_len ?
+					  (char *)entry->value : NULL,
+					  entry->val_len);
+		if (rc) {
+			LOG_ERR("failed to flush %s (err %d)", entry->name, rc);
+			break;
+		}
+
+		cache_stats.writes++;
+	}
+
+	/* Keep whatever could not be written for the next attempt */
+	cache_cnt -= i;
+	memmove(&cache[0], &cache[i], cache_cnt * sizeof(cache[0]));
+	cache_stats.flushes++;
+
+	return rc;
+}
+
+static void flush_work_handler(struct k_work *work)
+{
+	k_mutex_lock(&settings_lock, K_FOREVER);
+	(void)settings_write_cache_flush();
+	k_mutex_unlock(&settings_lock);
+}
+
+int settings_write_cache_save(struct settings_store *cs, const char *name,
+			      const char *value, size_t val_len)
+{
+	struct settings_write_cache_entry *entry;
+	int rc;
+
+	cache_stats.saves++;
+
+	entry = cache_find(name);
+
+	if (val_len > sizeof(entry->value) ||
+	    strlen(name) >= sizeof(entry->name)) {
+		/* Too large to be cached, the pending value is obsolete */
+		if (entry) {
+			cache_remove(entry);
+			cache_stats.avoided++;
+		}
+
+		cache_stats.writes++;
+		return cs->cs_itf->csi_save(cs, name, value, val_len);
+	}
+
+	if (entry) {
+		cache_stats.avoided++;
+	} else {
+		if (cache_cnt == ARRAY_SIZE(cache)) {
+			rc = settings_write_cache_flush();
+			if (rc) {
+				return rc;
+			}
+		}
+
+		entry = &cache[cache_cnt++];
+		strcpy(entry->name, name);
+	}
+
+	if (value && val_len) {
+		memcpy(entry->value, value, val_len);
+	}
+	entry->val_len = value ? val_len : 0;
+
+	/* The timeout runs from the oldest pending save */
+	if (!k_delayed_work_remaining_get(&flush_work)) {
+		k_delayed_work_submit(&flush_work,
+				K_MSEC(CONFIG_SETTINGS_WRITE_CACHE_TIMEOUT));
+	}
+
+	return 0;
+}
+
+void settings_write_cache_stats_get(struct settings_write_cache_stats *stats)
+{
+	k_mutex_lock(&settings_lock, K_FOREVER);
+	*stats = cache_stats;
+	k_mutex_unlock(&settings_lock);
+}
+
+void settings_write_cache_init(void)
+{
+	k_delayed_work_init(&flush_work, flush_work_handler);
+}
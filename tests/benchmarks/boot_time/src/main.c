@@ -13,12 +13,34 @@
  *  1. From __start to main()
  *  2. From __start to task
  *  3. From __start to idle
+ *  4. Init time of each device
  */
 
 #include <zephyr.h>
 #include <tc_util.h>
 #include <kernel_internal.h>
 
+static void print_device_init_times(void)
+{
+	struct device *info;
+	u32_t cycles;
+
+	for (info = __device_init_start; info < __device_init_end; info++) {
+		cycles = __device_init_cycles_start[info - __device_init_start];
+
+		/* SYS_INIT() entries have no name */
+		if (info->config->name[0] != '\0') {
+			TC_PRINT("init %s: %u cycles, %u us\n",
+				 info->config->name, cycles,
+				 k_cyc_to_us_ceil32(cycles));
+		} else {
+			TC_PRINT("init %p: %u cycles, %u us\n",
+				 info->config->init, cycles,
+				 k_cyc_to_us_ceil32(cycles));
+		}
+	}
+}
+
 void main(void)
 {
 	u32_t task_time_stamp;	/* timestamp at beginning of first task */
@@ -52,6 +74,7 @@ void main(void)
 						       task_us);
 	TC_PRINT("_start->idle  : %u cycles, %u us\n", z_timestamp_idle,
 						       idle_us);
+	print_device_init_times();
 	TC_PRINT("Boot Time Measurement finished\n");
 
 	TC_END_RESULT(TC_PASS);
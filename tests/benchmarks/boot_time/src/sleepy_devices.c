@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Devices whose init function sleeps, standing for a PHY or a card taking
+ * time to come up. sleepy_c depends on sleepy_a, so with parallel
+ * initialization the three of them take two sleeps instead of three.
+ * Only built with CONFIG_DEVICE_INIT_PARALLEL.
+ */
+
+#include <zephyr.h>
+#include <device.h>
+
+#define SLEEPY_INIT_PRIO	90
+#define SLEEPY_INIT_TIME	K_MSEC(20)
+
+static int sleepy_init(struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	k_sleep(SLEEPY_INIT_TIME);
+
+	return 0;
+}
+
+DEVICE_INIT(sleepy_a, "SLEEPY_A", sleepy_init, NULL, NULL, APPLICATION,
+	    SLEEPY_INIT_PRIO);
+DEVICE_INIT_PARALLEL(sleepy_a);
+
+DEVICE_INIT(sleepy_b, "SLEEPY_B", sleepy_init, NULL, NULL, APPLICATION,
+	    SLEEPY_INIT_PRIO);
+DEVICE_INIT_PARALLEL(sleepy_b);
+
+DEVICE_INIT(sleepy_c, "SLEEPY_C", sleepy_init, NULL, NULL, APPLICATION,
+	    SLEEPY_INIT_PRIO);
+DEVICE_INIT_PARALLEL(sleepy_c, "SLEEPY_A");
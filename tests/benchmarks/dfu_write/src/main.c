@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <sys/printk.h>
+#include <string.h>
+#include <dfu/flash_img.h>
+
+#define IMAGE_SIZE	(48U * 1024U)
+#define CHUNK_SIZE	512U
+
+/* Link rate of one chunk per millisecond, about 500 KiB/s */
+#define CHUNK_DELAY_MS	1
+
+#define SENDER_STACK_SIZE 1024
+#define SENDER_PRIORITY	5
+
+struct chunk {
+	u8_t data[CHUNK_SIZE];
+};
+
+K_MSGQ_DEFINE(link, sizeof(struct chunk), 4, 4);
+
+K_THREAD_STACK_DEFINE(sender_stack, SENDER_STACK_SIZE);
+static struct k_thread sender_thread;
+
+static struct flash_img_context ctx;
+static struct chunk rx;
+
+static void sender(void *p1, void *p2, void *p3)
+{
+	static struct chunk tx;
+
+	for (u32_t off = 0U; off < IMAGE_SIZE; off += CHUNK_SIZE) {
+		for (u32_t i = 0U; i < CHUNK_SIZE; i++) {
+			tx.data[i] = (u8_t)(off + i);
+		}
+
+		k_msgq_put(&link, &tx, K_FOREVER);
+		k_sleep(K_MSEC(CHUNK_DELAY_MS));
+	}
+}
+
+void main(void)
+{
+	u32_t start;
+	u32_t ms;
+	int rc;
+
+	/* The slot is erased progressively, along with the writes */
+	rc = flash_img_init(&ctx);
+	if (rc) {
+		printk("Failed to open the image slot (err %d)\n", rc);
+		return;
+	}
+
+	start = k_uptime_get_32();
+
+	k_thread_create(&sender_thread, sender_stack,
+			K_THREAD_STACK_SIZEOF(sender_stack), sender,
+			NULL, NULL, NULL, SENDER_PRIORITY, 0, K_NO_WAIT);
+
+	for (u32_t off = 0U; off < IMAGE_SIZE; off += CHUNK_SIZE) {
+		k_msgq_get(&link, &rx, K_FOREVER);
+
+		rc = flash_img_buffered_write(&ctx, rx.data, CHUNK_SIZE,
+					      off + CHUNK_SIZE == IMAGE_SIZE);
+		if (rc) {
+			printk("Failed to write at %u (err %d)\n", off, rc);
+			return;
+		}
+	}
+
+	ms = k_uptime_get_32() - start;
+
+	printk("dfu_write: %u bytes in %u ms\n", IMAGE_SIZE, ms);
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <sys/printk.h>
+#include <string.h>
+#include <fs/fcb.h>
+#include <storage/flash_map.h>
+
+#define BENCH_MAX_SECTORS	64
+#define BENCH_ELEM_LEN		24
+
+static struct flash_sector sectors[BENCH_MAX_SECTORS];
+static struct fcb fcb;
+
+struct walk_stats {
+	u32_t elements;
+	u32_t bytes;
+};
+
+static int walk_cb(struct fcb_entry_ctx *loc_ctx, void *arg)
+{
+	struct walk_stats *stats = arg;
+
+	stats->elements++;
+	stats->bytes += loc_ctx->loc.fe_data_len;
+
+	return 0;
+}
+
+static int storage_init(void)
+{
+	const struct flash_area *fap;
+	u32_t cnt = ARRAY_SIZE(sectors);
+	int err;
+
+	err = flash_area_open(DT_FLASH_AREA_STORAGE_ID, &fap);
+	if (err) {
+		return err;
+	}
+
+	err = flash_area_erase(fap, 0, fap->fa_size);
+	flash_area_close(fap);
+	if (err) {
+		return err;
+	}
+
+	err = flash_area_get_sectors(DT_FLASH_AREA_STORAGE_ID, &cnt, sectors);
+	if (err) {
+		return err;
+	}
+
+	fcb.f_magic = 0x42434657;
+	fcb.f_sectors = sectors;
+	fcb.f_sector_cnt = cnt;
+	fcb.f_scratch_cnt = 1U;
+
+	return fcb_init(DT_FLASH_AREA_STORAGE_ID, &fcb);
+}
+
+static int storage_fill(void)
+{
+	u8_t data[BENCH_ELEM_LEN];
+	struct fcb_entry loc;
+	u32_t i;
+	int err;
+
+	for (i = 0U; ; i++) {
+		err = fcb_append(&fcb, sizeof(data), &loc);
+		if (err == -ENOSPC) {
+			return 0;
+		}
+		if (err) {
+			return err;
+		}
+
+		(void)memset(data, i, sizeof(data));
+		err = flash_area_write(fcb.fap, FCB_ENTRY_FA_DATA_OFF(loc),
+				       data, sizeof(data));
+		if (err) {
+			return err;
+		}
+
+		err = fcb_append_finish(&fcb, &loc);
+		if (err) {
+			return err;
+		}
+	}
+}
+
+void main(void)
+{
+	struct walk_stats stats = { 0 };
+	u32_t start, cycles;
+	int err;
+
+	err = storage_init();
+	if (err) {
+		printk("Failed to init FCB (err %d)\n", err);
+		return;
+	}
+
+	err = storage_fill();
+	if (err) {
+		printk("Failed to fill FCB (err %d)\n", err);
+		return;
+	}
+
+	start = k_cycle_get_32();
+	err = fcb_walk(&fcb, NULL, walk_cb, &stats);
+	cycles = k_cycle_get_32() - start;
+	if (err) {
+		printk("Failed to walk FCB (err %d)\n", err);
+		return;
+	}
+
+	printk("fcb_walk: %u elements, %u bytes in %u us\n", stats.elements,
+	       stats.bytes, k_cyc_to_us_floor32(cycles));
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <sys/printk.h>
+#include <string.h>
+
+#define WORD_SIZE	sizeof(uintptr_t)
+#define SIZE_MAX_BENCH	4096U
+#define REPEAT		16U
+
+static const size_t sizes[] = { 1, 4, 16, 64, 256, 1024, 4096 };
+
+static u8_t src_buf[SIZE_MAX_BENCH + WORD_SIZE + 1] __aligned(WORD_SIZE);
+static u8_t dst_buf[SIZE_MAX_BENCH + WORD_SIZE + 1] __aligned(WORD_SIZE);
+
+/* Keep the results alive, so that the calls are not optimized out */
+static volatile uintptr_t sink;
+
+enum bench_fn {
+	BENCH_MEMCPY,
+	BENCH_MEMMOVE,
+	BENCH_MEMSET,
+	BENCH_MEMCMP,
+	BENCH_MEMCHR,
+	BENCH_STRLEN,
+};
+
+static const char *const fn_names[] = {
+	"memcpy", "memmove", "memset", "memcmp", "memchr", "strlen",
+};
+
+static void run(enum bench_fn fn, u8_t *dst, u8_t *src, size_t n)
+{
+	switch (fn) {
+	case BENCH_MEMCPY:
+		sink = (uintptr_t)memcpy(dst, src, n);
+		break;
+	case BENCH_MEMMOVE:
+		sink = (uintptr_t)memmove(dst, src, n);
+		break;
+	case BENCH_MEMSET:
+		sink = (uintptr_t)memset(dst, 0x5a, n);
+		break;
+	case BENCH_MEMCMP:
+		sink = memcmp(dst, src, n);
+		break;
+	case BENCH_MEMCHR:
+		sink = (uintptr_t)memchr(src, 0x01, n);
+		break;
+	case BENCH_STRLEN:
+		sink = strlen((const char *)src);
+		break;
+	}
+}
+
+static u32_t measure(enum bench_fn fn, size_t n, size_t src_off,
+		     size_t dst_off)
+{
+	u8_t *src = src_buf + src_off;
+	u8_t *dst = dst_buf + dst_off;
+	u32_t start;
+
+	/* Worst case inputs: equal buffers, one match at the very end */
+	(void)memset(src_buf, 0xa5, sizeof(src_buf));
+	src[n - 1] = 0x01;
+	src[n] = '\0';
+	(void)memcpy(dst, src, n);
+
+	start = k_cycle_get_32();
+	for (u32_t i = 0U; i < REPEAT; i++) {
+		run(fn, dst, src, n);
+	}
+
+	return (k_cycle_get_32() - start) / REPEAT;
+}
+
+static void bench(enum bench_fn fn, size_t n)
+{
+	u32_t aligned = 0U;
+	u32_t sum = 0U;
+	u32_t max = 0U;
+	u32_t cnt = 0U;
+	u32_t cycles;
+
+	for (size_t src_off = 0; src_off < WORD_SIZE; src_off++) {
+		for (size_t dst_off = 0; dst_off < WORD_SIZE; dst_off++) {
+			cycles = measure(fn, n, src_off, dst_off);
+
+			if (src_off == 0 && dst_off == 0) {
+				aligned = cycles;
+			} else {
+				sum += cycles;
+				max = MAX(max, cycles);
+				cnt++;
+			}
+		}
+	}
+
+	printk("libc_string: %s %u B: aligned %u, misaligned avg %u max %u\n",
+	       fn_names[fn], (u32_t)n, aligned, sum / cnt, max);
+}
+
+void main(void)
+{
+	for (int fn = 0; fn < ARRAY_SIZE(fn_names); fn++) {
+		for (size_t i = 0; i < ARRAY_SIZE(sizes); i++) {
+			bench(fn, sizes[i]);
+		}
+	}
+
+	printk("libc_string: done\n");
+}
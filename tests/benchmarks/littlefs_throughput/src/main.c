@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <sys/printk.h>
+#include <string.h>
+#include <fs/fs.h>
+#include <fs/littlefs.h>
+#include <storage/flash_map.h>
+
+#define MNT_POINT	"/lfs"
+#define FILE_PATH	MNT_POINT "/bench"
+
+#define SEQ_CHUNK	4096U
+#define RAND_CHUNK	256U
+
+static const u32_t file_sizes[] = {
+	4U * 1024U,
+	16U * 1024U,
+	64U * 1024U,
+	256U * 1024U,
+	1024U * 1024U,
+};
+
+static u8_t buf[SEQ_CHUNK];
+
+FS_LITTLEFS_DECLARE_DEFAULT_CONFIG(storage);
+static struct fs_mount_t mnt = {
+	.type = FS_LITTLEFS,
+	.fs_data = &storage,
+	.storage_dev = (void *)DT_FLASH_AREA_STORAGE_ID,
+	.mnt_point = MNT_POINT,
+};
+
+/* Deterministic offsets, identical for every run and configuration */
+static u32_t rand_state = 2463534242U;
+
+static u32_t rand_next(void)
+{
+	rand_state ^= rand_state << 13;
+	rand_state ^= rand_state >> 17;
+	rand_state ^= rand_state << 5;
+
+	return rand_state;
+}
+
+static u32_t kib_per_sec(u32_t bytes, u32_t cycles)
+{
+	u64_t us = MAX(k_cyc_to_us_floor64(cycles), 1U);
+
+	return (u32_t)((u64_t)bytes * USEC_PER_SEC / 1024U / us);
+}
+
+static int seq_write(u32_t size, u32_t *cycles)
+{
+	struct fs_file_t file;
+	u32_t start;
+	u32_t off;
+	int rc;
+
+	rc = fs_open(&file, FILE_PATH);
+	if (rc) {
+		return rc;
+	}
+
+	start = k_cycle_get_32();
+	for (off = 0U; off < size; off += SEQ_CHUNK) {
+		(void)memset(buf, off / SEQ_CHUNK, sizeof(buf));
+		rc = fs_write(&file, buf, MIN(SEQ_CHUNK, size - off));
+		if (rc < 0) {
+			break;
+		}
+	}
+	if (rc >= 0) {
+		rc = fs_close(&file);
+	} else {
+		(void)fs_close(&file);
+	}
+	*cycles = k_cycle_get_32() - start;
+
+	return (rc < 0) ? rc : 0;
+}
+
+static int seq_read(u32_t size, u32_t *cycles)
+{
+	struct fs_file_t file;
+	u32_t start;
+	u32_t off;
+	int rc;
+
+	rc = fs_open(&file, FILE_PATH);
+	if (rc) {
+		return rc;
+	}
+
+	start = k_cycle_get_32();
+	for (off = 0U; off < size; off += SEQ_CHUNK) {
+		rc = fs_read(&file, buf, MIN(SEQ_CHUNK, size - off));
+		if (rc < 0) {
+			break;
+		}
+	}
+	*cycles = k_cycle_get_32() - start;
+	(void)fs_close(&file);
+
+	return (rc < 0) ? rc : 0;
+}
+
+static int rand_read(u32_t size, u32_t *cycles)
+{
+	struct fs_file_t file;
+	u32_t start;
+	u32_t done;
+	int rc;
+
+	rc = fs_open(&file, FILE_PATH);
+	if (rc) {
+		return rc;
+	}
+
+	start = k_cycle_get_32();
+	for (done = 0U; done < size; done += RAND_CHUNK) {
+		off_t off = rand_next() % (size / RAND_CHUNK) * RAND_CHUNK;
+
+		rc = fs_seek(&file, off, FS_SEEK_SET);
+		if (rc < 0) {
+			break;
+		}
+
+		rc = fs_read(&file, buf, RAND_CHUNK);
+		if (rc < 0) {
+			break;
+		}
+	}
+	*cycles = k_cycle_get_32() - start;
+	(void)fs_close(&file);
+
+	return (rc < 0) ? rc : 0;
+}
+
+static int bench(u32_t size)
+{
+	u32_t wr_cycles, rd_cycles, rnd_cycles;
+	int rc;
+
+	rc = seq_write(size, &wr_cycles);
+	if (rc == 0) {
+		rc = seq_read(size, &rd_cycles);
+	}
+	if (rc == 0) {
+		rc = rand_read(size, &rnd_cycles);
+	}
+	(void)fs_unlink(FILE_PATH);
+	if (rc) {
+		return rc;
+	}
+
+	printk("littlefs: %u KiB: seq write %u KiB/s, seq read %u KiB/s, "
+	       "rand read %u KiB/s\n", size / 1024U,
+	       kib_per_sec(size, wr_cycles), kib_per_sec(size, rd_cycles),
+	       kib_per_sec(size, rnd_cycles));
+
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	struct fs_littlefs_cache_stats stats;
+
+	fs_littlefs_cache_stats_get(&storage, &stats);
+	printk("littlefs: cache hits %u, misses %u, read ahead %u\n",
+	       stats.hits, stats.misses, stats.read_ahead);
+#endif
+
+	return 0;
+}
+
+static int storage_erase(void)
+{
+	const struct flash_area *fap;
+	int rc;
+
+	rc = flash_area_open(DT_FLASH_AREA_STORAGE_ID, &fap);
+	if (rc) {
+		return rc;
+	}
+
+	rc = flash_area_erase(fap, 0, fap->fa_size);
+	flash_area_close(fap);
+
+	return rc;
+}
+
+void main(void)
+{
+	struct fs_statvfs vfs;
+	u32_t avail;
+	int rc;
+
+	for (size_t i = 0; i < ARRAY_SIZE(file_sizes); i++) {
+		/* Fresh file system, so that every size starts alike */
+		rc = storage_erase();
+		if (rc == 0) {
+			rc = fs_mount(&mnt);
+		}
+		if (rc == 0) {
+			rc = fs_statvfs(MNT_POINT, &vfs);
+		}
+		if (rc) {
+			printk("Failed to mount %s (err %d)\n", MNT_POINT, rc);
+			return;
+		}
+
+		/* Leave room for the metadata and copy-on-write blocks */
+		avail = vfs.f_bfree * vfs.f_frsize;
+		if (file_sizes[i] > avail / 4U * 3U) {
+			printk("littlefs: %u KiB: skipped, %u bytes free\n",
+			       file_sizes[i] / 1024U, avail);
+		} else {
+			rc = bench(file_sizes[i]);
+			if (rc) {
+				printk("Failed on %u bytes (err %d)\n",
+				       file_sizes[i], rc);
+			}
+		}
+
+		fs_unmount(&mnt);
+		if (rc) {
+			return;
+		}
+	}
+
+	printk("littlefs: done\n");
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <sys/printk.h>
+
+#define NUM_THREADS	CONFIG_MP_NUM_CPUS
+#define ITERATIONS	10000
+#define STACK_SIZE	1024
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_THREADS, STACK_SIZE);
+static struct k_thread threads[NUM_THREADS];
+
+static K_MUTEX_DEFINE(mutex);
+static K_SEM_DEFINE(start, 0, NUM_THREADS);
+static K_SEM_DEFINE(done, 0, NUM_THREADS);
+
+static const u32_t hold_times_us[] = { 0, 1, 5, 20, 100 };
+
+/* Time each contender holds the mutex, then works outside of it */
+static u32_t hold_us;
+static volatile u32_t counter;
+
+static void contender(void *p1, void *p2, void *p3)
+{
+	int i;
+
+	while (true) {
+		k_sem_take(&start, K_FOREVER);
+
+		for (i = 0; i < ITERATIONS; i++) {
+			k_mutex_lock(&mutex, K_FOREVER);
+			counter++;
+			k_busy_wait(hold_us);
+			k_mutex_unlock(&mutex);
+
+			k_busy_wait(hold_us);
+		}
+
+		k_sem_give(&done);
+	}
+}
+
+static void run(void)
+{
+	u32_t start_cycles, cycles;
+	int i;
+
+	counter = 0U;
+	start_cycles = k_cycle_get_32();
+
+	for (i = 0; i < NUM_THREADS; i++) {
+		k_sem_give(&start);
+	}
+
+	for (i = 0; i < NUM_THREADS; i++) {
+		k_sem_take(&done, K_FOREVER);
+	}
+
+	cycles = k_cycle_get_32() - start_cycles;
+
+	if (counter != NUM_THREADS * ITERATIONS) {
+		printk("mutex_contention: lost updates, %u of %u\n", counter,
+		       NUM_THREADS * ITERATIONS);
+	}
+
+	printk("mutex_contention: hold %u us: %u us total, %u cycles/lock\n",
+	       hold_us, k_cyc_to_us_ceil32(cycles),
+	       cycles / (NUM_THREADS * ITERATIONS));
+}
+
+void main(void)
+{
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	struct k_mutex_spin_stats prev = { 0 };
+	struct k_mutex_spin_stats stats;
+#endif
+	int i;
+
+	for (i = 0; i < NUM_THREADS; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE,
+				contender, NULL, NULL, NULL,
+				K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	}
+
+	for (i = 0; i < ARRAY_SIZE(hold_times_us); i++) {
+		hold_us = hold_times_us[i];
+		run();
+
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+		k_mutex_spin_stats_get(&stats);
+		printk("mutex_contention: spin acquired %u failed %u, "
+		       "blocked %u\n",
+		       stats.spin_acquired - prev.spin_acquired,
+		       stats.spin_failed - prev.spin_failed,
+		       stats.blocked - prev.blocked);
+		prev = stats;
+#endif
+	}
+
+	printk("mutex_contention: done\n");
+}
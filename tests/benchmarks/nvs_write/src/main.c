@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <sys/printk.h>
+#include <string.h>
+#include <drivers/flash.h>
+#include <storage/flash_map.h>
+#include <fs/nvs.h>
+
+#define BENCH_SECTOR_COUNT	8U
+#define BENCH_IDS		16U
+#define BENCH_WRITES		2000U
+#define BENCH_DATA_LEN		32U
+
+static struct nvs_fs fs;
+
+static int storage_init(void)
+{
+	const struct flash_area *fap;
+	struct flash_pages_info info;
+	int err;
+
+	err = flash_area_open(DT_FLASH_AREA_STORAGE_ID, &fap);
+	if (err) {
+		return err;
+	}
+
+	err = flash_area_erase(fap, 0, fap->fa_size);
+	if (err) {
+		flash_area_close(fap);
+		return err;
+	}
+
+	err = flash_get_page_info_by_offs(flash_area_get_device(fap),
+					  fap->fa_off, &info);
+	flash_area_close(fap);
+	if (err) {
+		return err;
+	}
+
+	fs.offset = DT_FLASH_AREA_STORAGE_OFFSET;
+	fs.sector_size = info.size;
+	fs.sector_count = BENCH_SECTOR_COUNT;
+
+	return nvs_init(&fs, DT_FLASH_DEV_NAME);
+}
+
+void main(void)
+{
+	u8_t data[BENCH_DATA_LEN];
+	u32_t start, cycles;
+	u32_t max = 0U;
+	u64_t total = 0U;
+	ssize_t len;
+	u32_t i;
+	int err;
+
+	err = storage_init();
+	if (err) {
+		printk("Failed to init NVS (err %d)\n", err);
+		return;
+	}
+
+	for (i = 0U; i < BENCH_WRITES; i++) {
+		(void)memset(data, i, sizeof(data));
+
+		start = k_cycle_get_32();
+		len = nvs_write(&fs, i % BENCH_IDS, data, sizeof(data));
+		cycles = k_cycle_get_32() - start;
+		if (len != sizeof(data)) {
+			printk("Failed to write (err %d)\n", (int)len);
+			return;
+		}
+
+		total += cycles;
+		if (cycles > max) {
+			max = cycles;
+		}
+
+		/* Idle time, as between the updates of a real application */
+		k_sleep(K_MSEC(5));
+	}
+
+	printk("nvs_write: %u writes, max %u us, avg %u us\n", BENCH_WRITES,
+	       k_cyc_to_us_floor32(max),
+	       k_cyc_to_us_floor32((u32_t)(total / BENCH_WRITES)));
+}
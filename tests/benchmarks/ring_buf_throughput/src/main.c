@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <sys/printk.h>
+#include <sys/ring_buffer.h>
+#include <irq_offload.h>
+
+#define RING_POW	8
+#define CHUNK_SIZE	16
+#define TOTAL_SIZE	(64 * 1024)
+#define STACK_SIZE	1024
+
+RING_BUF_DECLARE(locked_buf, BIT(RING_POW));
+RING_BUF_LF_DECLARE_POW2(lf_buf, RING_POW);
+
+static K_THREAD_STACK_DEFINE(producer_stack, STACK_SIZE);
+static struct k_thread producer_thread;
+
+static K_SEM_DEFINE(start, 0, 1);
+static K_SEM_DEFINE(done, 0, 1);
+
+struct variant {
+	const char *name;
+	void (*reset)(void);
+	u32_t (*put)(const u8_t *data, u32_t size);
+	u32_t (*get)(u8_t *data, u32_t size);
+};
+
+static void locked_reset(void)
+{
+	ring_buf_reset(&locked_buf);
+}
+
+static u32_t locked_put(const u8_t *data, u32_t size)
+{
+	unsigned int key = irq_lock();
+	u32_t ret = ring_buf_put(&locked_buf, data, size);
+
+	irq_unlock(key);
+
+	return ret;
+}
+
+static u32_t locked_get(u8_t *data, u32_t size)
+{
+	unsigned int key = irq_lock();
+	u32_t ret = ring_buf_get(&locked_buf, data, size);
+
+	irq_unlock(key);
+
+	return ret;
+}
+
+static void lf_reset(void)
+{
+	ring_buf_lf_init(&lf_buf, BIT(RING_POW), lf_buf.buf);
+}
+
+static u32_t spsc_put(const u8_t *data, u32_t size)
+{
+	return ring_buf_lf_put(&lf_buf, data, size);
+}
+
+static u32_t mpsc_put(const u8_t *data, u32_t size)
+{
+	return ring_buf_lf_mp_put(&lf_buf, data, size);
+}
+
+static u32_t lf_get(u8_t *data, u32_t size)
+{
+	return ring_buf_lf_get(&lf_buf, data, size);
+}
+
+static const struct variant variants[] = {
+	{ "locked", locked_reset, locked_put, locked_get },
+	{ "spsc", lf_reset, spsc_put, lf_get },
+	{ "mpsc", lf_reset, mpsc_put, lf_get },
+};
+
+static const struct variant *variant;
+static bool from_isr;
+
+/* Producer state, also accessed from the offloaded interrupt */
+static u8_t tx_chunk[CHUNK_SIZE];
+static u32_t tx_size;
+static u32_t tx_written;
+
+static void put_chunk(void *arg)
+{
+	ARG_UNUSED(arg);
+
+	tx_written = variant->put(tx_chunk, tx_size);
+}
+
+static void producer(void *p1, void *p2, void *p3)
+{
+	u32_t sent;
+
+	while (true) {
+		k_sem_take(&start, K_FOREVER);
+
+		for (sent = 0U; sent < TOTAL_SIZE; sent += tx_written) {
+			tx_size = MIN(CHUNK_SIZE, TOTAL_SIZE - sent);
+
+			if (from_isr) {
+				irq_offload(put_chunk, NULL);
+			} else {
+				put_chunk(NULL);
+			}
+
+			if (tx_written == 0U) {
+				k_yield();
+			}
+		}
+
+		k_sem_give(&done);
+	}
+}
+
+static void run(const struct variant *v, bool isr)
+{
+	u8_t rx_chunk[CHUNK_SIZE];
+	u32_t start_cycles, cycles;
+	u32_t received, len;
+
+	variant = v;
+	from_isr = isr;
+	v->reset();
+
+	start_cycles = k_cycle_get_32();
+	k_sem_give(&start);
+
+	for (received = 0U; received < TOTAL_SIZE; received += len) {
+		len = v->get(rx_chunk, sizeof(rx_chunk));
+		if (len == 0U) {
+			k_yield();
+		}
+	}
+
+	k_sem_take(&done, K_FOREVER);
+	cycles = k_cycle_get_32() - start_cycles;
+
+	printk("ring_buf_throughput: %s %s: %u bytes in %u us, "
+	       "%u cycles/chunk\n", v->name, isr ? "isr" : "thread",
+	       received, k_cyc_to_us_ceil32(cycles),
+	       cycles / (TOTAL_SIZE / CHUNK_SIZE));
+}
+
+void main(void)
+{
+	int prio = k_thread_priority_get(k_current_get());
+	int i;
+
+	for (i = 0; i < CHUNK_SIZE; i++) {
+		tx_chunk[i] = i;
+	}
+
+	k_thread_create(&producer_thread, producer_stack,
+			K_THREAD_STACK_SIZEOF(producer_stack), producer,
+			NULL, NULL, NULL, prio, 0, K_NO_WAIT);
+
+	for (i = 0; i < ARRAY_SIZE(variants); i++) {
+		run(&variants[i], false);
+		run(&variants[i], true);
+	}
+
+	printk("ring_buf_throughput: done\n");
+}
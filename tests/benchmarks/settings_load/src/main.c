@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <sys/printk.h>
+#include <settings/settings.h>
+#include <storage/flash_map.h>
+
+/* Number of distinct settings, each one is saved BENCH_ROUNDS times */
+#define BENCH_KEYS	500
+#define BENCH_ROUNDS	2
+
+/* Unrelated handlers, as registered by other subsystems and libraries */
+#define BENCH_HANDLERS	24
+
+static u32_t loaded;
+
+static char handler_names[BENCH_HANDLERS][sizeof("other00")];
+static struct settings_handler handlers[BENCH_HANDLERS];
+
+static int bench_set(const char *name, size_t len, settings_read_cb read_cb,
+		     void *cb_arg)
+{
+	u32_t val;
+
+	if (read_cb(cb_arg, &val, sizeof(val)) == sizeof(val)) {
+		loaded++;
+	}
+
+	return 0;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(bench, "bench", NULL, bench_set, NULL, NULL);
+
+static int storage_erase(void)
+{
+	const struct flash_area *fap;
+	int err;
+
+	err = flash_area_open(DT_FLASH_AREA_STORAGE_ID, &fap);
+	if (err) {
+		return err;
+	}
+
+	err = flash_area_erase(fap, 0, fap->fa_size);
+	flash_area_close(fap);
+
+	return err;
+}
+
+void main(void)
+{
+	char name[SETTINGS_MAX_NAME_LEN];
+	u32_t start, cycles;
+	u32_t round, i;
+	int err;
+
+	err = storage_erase();
+	if (err) {
+		printk("Failed to erase storage (err %d)\n", err);
+		return;
+	}
+
+	err = settings_subsys_init();
+	if (err) {
+		printk("Failed to init settings (err %d)\n", err);
+		return;
+	}
+
+	for (i = 0U; i < BENCH_HANDLERS; i++) {
+		snprintk(handler_names[i], sizeof(handler_names[i]),
+			 "other%02u", i);
+		handlers[i].name = handler_names[i];
+
+		err = settings_register(&handlers[i]);
+		if (err) {
+			printk("Failed to register handler (err %d)\n", err);
+			return;
+		}
+	}
+
+	for (round = 0U; round < BENCH_ROUNDS; round++) {
+		for (i = 0U; i < BENCH_KEYS; i++) {
+			u32_t val = round * BENCH_KEYS + i;
+
+			snprintk(name, sizeof(name), "bench/k%03u", i);
+			err = settings_save_one(name, &val, sizeof(val));
+			if (err) {
+				printk("Failed to save %s (err %d)\n", name,
+				       err);
+				return;
+			}
+		}
+	}
+
+	start = k_cycle_get_32();
+	err = settings_load();
+	cycles = k_cycle_get_32() - start;
+	if (err) {
+		printk("Failed to load settings (err %d)\n", err);
+		return;
+	}
+
+	printk("settings_load: %u records, %u loaded in %u us\n",
+	       BENCH_KEYS * BENCH_ROUNDS, loaded,
+	       k_cyc_to_us_floor32(cycles));
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <device.h>
+#include <drivers/flash.h>
+#include <sys/printk.h>
+#include <string.h>
+
+#define FLASH_SIZE	(DT_INST_0_JEDEC_SPI_NOR_SIZE / 8)
+#define REGION_SIZE	(64U * 1024U)
+#define REGION_OFFSET	(FLASH_SIZE - REGION_SIZE)
+
+#define CHUNK_MAX	4096U
+
+#define LOAD_THREAD_STACK_SIZE 256
+
+static u8_t wr_buf[CHUNK_MAX];
+static u8_t rd_buf[CHUNK_MAX];
+
+/* Incremented whenever the CPU is left to the lowest priority */
+static volatile u32_t idle_count;
+static u32_t idle_per_ms;
+
+K_THREAD_STACK_DEFINE(load_stack, LOAD_THREAD_STACK_SIZE);
+static struct k_thread load_thread;
+
+static void load_thread_entry(void *p1, void *p2, void *p3)
+{
+	while (1) {
+		idle_count++;
+	}
+}
+
+struct measure {
+	u32_t start_ms;
+	u32_t start_count;
+};
+
+static void measure_start(struct measure *m)
+{
+	m->start_count = idle_count;
+	m->start_ms = k_uptime_get_32();
+}
+
+/* Return the elapsed time in ms, and the CPU share left to other threads */
+static u32_t measure_end(struct measure *m, u32_t *cpu_free)
+{
+	u32_t ms = MAX(k_uptime_get_32() - m->start_ms, 1U);
+	u32_t count = idle_count - m->start_count;
+
+	*cpu_free = MIN((u64_t)count * 100U / ((u64_t)idle_per_ms * ms), 100U);
+
+	return ms;
+}
+
+static void calibrate(void)
+{
+	u32_t count = idle_count;
+
+	k_sleep(K_MSEC(1000));
+	idle_per_ms = MAX((idle_count - count) / 1000U, 1U);
+}
+
+static int bench_chunks(struct device *dev, size_t chunk)
+{
+	struct measure m;
+	u32_t cpu_free;
+	u32_t ms;
+	int rc;
+
+	rc = flash_write_protection_set(dev, false);
+	if (rc == 0) {
+		rc = flash_erase(dev, REGION_OFFSET, REGION_SIZE);
+	}
+	if (rc) {
+		return rc;
+	}
+
+	measure_start(&m);
+	for (u32_t off = 0U; off < REGION_SIZE; off += chunk) {
+		(void)memset(wr_buf, off / chunk, chunk);
+		rc = flash_write_protection_set(dev, false);
+		if (rc == 0) {
+			rc = flash_write(dev, REGION_OFFSET + off, wr_buf,
+					 chunk);
+		}
+		if (rc) {
+			return rc;
+		}
+	}
+	ms = measure_end(&m, &cpu_free);
+	printk("spi_nor: write %u B chunks: %u KiB/s, %u%% CPU free\n",
+	       (u32_t)chunk, REGION_SIZE * 1000U / 1024U / ms, cpu_free);
+
+	measure_start(&m);
+	for (u32_t off = 0U; off < REGION_SIZE; off += chunk) {
+		rc = flash_read(dev, REGION_OFFSET + off, rd_buf, chunk);
+		if (rc) {
+			return rc;
+		}
+
+		(void)memset(wr_buf, off / chunk, chunk);
+		if (memcmp(wr_buf, rd_buf, chunk)) {
+			printk("Data mismatch at 0x%x\n", REGION_OFFSET + off);
+			return -EIO;
+		}
+	}
+	ms = measure_end(&m, &cpu_free);
+	printk("spi_nor: read %u B chunks: %u KiB/s, %u%% CPU free\n",
+	       (u32_t)chunk, REGION_SIZE * 1000U / 1024U / ms, cpu_free);
+
+	return 0;
+}
+
+void main(void)
+{
+	struct device *dev;
+	struct measure m;
+	u32_t cpu_free;
+	u32_t ms;
+	int rc;
+
+	dev = device_get_binding(DT_INST_0_JEDEC_SPI_NOR_LABEL);
+	if (!dev) {
+		printk("SPI flash %s not found\n",
+		       DT_INST_0_JEDEC_SPI_NOR_LABEL);
+		return;
+	}
+
+	k_thread_create(&load_thread, load_stack,
+			K_THREAD_STACK_SIZEOF(load_stack), load_thread_entry,
+			NULL, NULL, NULL, K_LOWEST_APPLICATION_THREAD_PRIO, 0,
+			K_NO_WAIT);
+	calibrate();
+
+	measure_start(&m);
+	rc = flash_write_protection_set(dev, false);
+	if (rc == 0) {
+		rc = flash_erase(dev, REGION_OFFSET, REGION_SIZE);
+	}
+	ms = measure_end(&m, &cpu_free);
+	if (rc) {
+		printk("Erase failed (err %d)\n", rc);
+		return;
+	}
+	printk("spi_nor: erase %u KiB in %u ms, %u%% CPU free\n",
+	       REGION_SIZE / 1024U, ms, cpu_free);
+
+	rc = bench_chunks(dev, 256U);
+	if (rc == 0) {
+		rc = bench_chunks(dev, CHUNK_MAX);
+	}
+	if (rc) {
+		printk("Failed (err %d)\n", rc);
+		return;
+	}
+
+	printk("spi_nor: done\n");
+}
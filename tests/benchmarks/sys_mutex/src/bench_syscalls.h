@@ -0,0 +1,16 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef _BENCH_SYSCALLS_H_
+#define _BENCH_SYSCALLS_H_
+#include <zephyr.h>
+
+/* The cycle counter can't be read from user mode on every platform */
+__syscall u32_t bench_cycle_get(void);
+
+#include <syscalls/bench_syscalls.h>
+
+#endif /* _BENCH_SYSCALLS_H_ */
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <syscall_handler.h>
+#include <sys/printk.h>
+#include <sys/mutex.h>
+#include <sys/sem.h>
+#include <sys/rwlock.h>
+#include <sys/condvar.h>
+#include <app_memory/app_memdomain.h>
+#include "bench_syscalls.h"
+
+#define ITERATIONS	1000
+
+K_APPMEM_PARTITION_DEFINE(bench_partition);
+#define BENCH_DMEM	K_APP_DMEM(bench_partition)
+
+static struct k_mem_domain bench_domain;
+
+BENCH_DMEM SYS_MUTEX_DEFINE(mutex);
+BENCH_DMEM SYS_SEM_DEFINE(sem, 0, 1);
+BENCH_DMEM SYS_RWLOCK_DEFINE(rwlock);
+BENCH_DMEM SYS_CONDVAR_DEFINE(condvar);
+BENCH_DMEM u32_t syscall_cycles;
+
+K_MUTEX_DEFINE(kernel_mutex);
+
+u32_t z_impl_bench_cycle_get(void)
+{
+	return k_cycle_get_32();
+}
+
+static inline u32_t z_vrfy_bench_cycle_get(void)
+{
+	return z_impl_bench_cycle_get();
+}
+#include <syscalls/bench_cycle_get_mrsh.c>
+
+static void report(const char *name, u32_t cycles)
+{
+	u32_t tenths = cycles * 10U / MAX(syscall_cycles, 1U);
+
+	printk("sys_mutex: %s: %u cycles, %u.%u syscalls\n", name, cycles,
+	       tenths / 10U, tenths % 10U);
+}
+
+#define BENCH(name, ops)						\
+	do {								\
+		u32_t start = bench_cycle_get();			\
+									\
+		for (int i = 0; i < ITERATIONS; i++) {			\
+			ops;						\
+		}							\
+									\
+		report(name, (bench_cycle_get() - start) / ITERATIONS); \
+	} while (false)
+
+static void user_entry(void *p1, void *p2, void *p3)
+{
+	u32_t start = bench_cycle_get();
+
+	for (int i = 0; i < ITERATIONS; i++) {
+		(void)k_current_get();
+	}
+
+	syscall_cycles = (bench_cycle_get() - start) / ITERATIONS;
+	printk("sys_mutex: syscall: %u cycles\n", syscall_cycles);
+
+	BENCH("sys_mutex lock/unlock",
+	      sys_mutex_lock(&mutex, K_FOREVER);
+	      sys_mutex_unlock(&mutex));
+	BENCH("sys_sem give/take",
+	      sys_sem_give(&sem);
+	      sys_sem_take(&sem, K_FOREVER));
+	BENCH("sys_rwlock rdlock/unlock",
+	      sys_rwlock_rdlock(&rwlock, K_FOREVER);
+	      sys_rwlock_unlock(&rwlock));
+	BENCH("sys_rwlock wrlock/unlock",
+	      sys_rwlock_wrlock(&rwlock, K_FOREVER);
+	      sys_rwlock_unlock(&rwlock));
+	BENCH("sys_condvar signal",
+	      sys_condvar_signal(&condvar));
+	BENCH("k_mutex lock/unlock",
+	      k_mutex_lock(&kernel_mutex, K_FOREVER);
+	      k_mutex_unlock(&kernel_mutex));
+
+	printk("sys_mutex: done\n");
+}
+
+void main(void)
+{
+	struct k_mem_partition *parts[] = {
+		&bench_partition,
+	};
+
+	k_mem_domain_init(&bench_domain, ARRAY_SIZE(parts), parts);
+	k_mem_domain_add_thread(&bench_domain, k_current_get());
+	k_thread_access_grant(k_current_get(), &kernel_mutex);
+
+	k_thread_user_mode_enter(user_entry, NULL, NULL, NULL);
+}
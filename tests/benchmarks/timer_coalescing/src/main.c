@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <sys/printk.h>
+
+#define NUM_TIMERS	8
+#define BASE_PERIOD	100
+#define PERIOD_STEP	7
+#define RUN_TIME	K_SECONDS(5)
+
+/* Expiries closer than this to the previous one share its wake-up */
+#define SAME_WAKEUP_US	50
+
+struct bench_timer {
+	struct k_timer timer;
+	u32_t period;
+	u32_t expiries;
+};
+
+static struct bench_timer timers[NUM_TIMERS];
+
+static const s32_t slacks[] = { 0, 5, 20 };
+
+static u32_t start_cycles;
+static u32_t last_cycles;
+static u32_t expiries;
+static u32_t wakeups;
+static s64_t lateness_sum;
+static s32_t lateness_max;
+
+static void timer_expire(struct k_timer *timer)
+{
+	struct bench_timer *bt = CONTAINER_OF(timer, struct bench_timer, timer);
+	u32_t now = k_cycle_get_32();
+	u32_t actual_us, nominal_us;
+	s32_t lateness;
+
+	if (expiries == 0U ||
+	    now - last_cycles > k_us_to_cyc_ceil32(SAME_WAKEUP_US)) {
+		wakeups++;
+	}
+	last_cycles = now;
+	expiries++;
+
+	bt->expiries++;
+	actual_us = k_cyc_to_us_floor32(now - start_cycles);
+	nominal_us = bt->expiries * bt->period * USEC_PER_MSEC;
+
+	/* Can be slightly negative since expiries are aligned on ticks */
+	lateness = (s32_t)(actual_us - nominal_us);
+	lateness_sum += lateness;
+	lateness_max = MAX(lateness_max, lateness);
+}
+
+static void run(s32_t slack)
+{
+	int i;
+
+	expiries = 0U;
+	wakeups = 0U;
+	lateness_sum = 0;
+	lateness_max = 0;
+
+	for (i = 0; i < NUM_TIMERS; i++) {
+		timers[i].expiries = 0U;
+		k_timer_slack_set(&timers[i].timer, slack);
+	}
+
+	start_cycles = k_cycle_get_32();
+	for (i = 0; i < NUM_TIMERS; i++) {
+		k_timer_start(&timers[i].timer, timers[i].period,
+			      timers[i].period);
+	}
+
+	k_sleep(RUN_TIME);
+
+	for (i = 0; i < NUM_TIMERS; i++) {
+		k_timer_stop(&timers[i].timer);
+	}
+
+	printk("timer_coalescing: slack %d ms: %u expiries, %u wake-ups, "
+	       "lateness avg %d us max %d us\n", slack, expiries, wakeups,
+	       expiries ? (s32_t)(lateness_sum / expiries) : 0,
+	       lateness_max);
+}
+
+void main(void)
+{
+	int i;
+
+	for (i = 0; i < NUM_TIMERS; i++) {
+		timers[i].period = BASE_PERIOD + i * PERIOD_STEP;
+		k_timer_init(&timers[i].timer, timer_expire, NULL);
+	}
+
+	for (i = 0; i < ARRAY_SIZE(slacks); i++) {
+		run(slacks[i]);
+	}
+
+	printk("timer_coalescing: done\n");
+}
@@ -51,6 +51,7 @@ void drop_to_user_mode(void);
 void user_thread_creation(void);
 void syscall_overhead(void);
 void validation_overhead(void);
+void syscall_batch_overhead(void);
 
 void userspace_bench(void)
 {
@@ -68,6 +69,8 @@ void userspace_bench(void)
 	syscall_overhead();
 
 	validation_overhead();
+
+	syscall_batch_overhead();
 }
 /******************************************************************************/
 
@@ -284,3 +287,66 @@ void validation_overhead(void)
 
 
 }
+
+/******************************************************************************/
+#ifdef CONFIG_SYSCALL_BATCH
+#define BATCH_OPS 32
+
+K_SEM_DEFINE(batch_sema, 0, 1);
+K_APP_BMEM(bench_ptn) struct k_syscall_batch_entry batch_entries[BATCH_OPS];
+K_APP_BMEM(bench_ptn) struct k_syscall_ring batch_ring;
+K_APP_BMEM(bench_ptn) u32_t direct_start_time, direct_end_time;
+K_APP_BMEM(bench_ptn) u32_t batch_start_time, batch_end_time;
+
+void syscall_batch_user_thread(void *p1, void *p2, void *p3)
+{
+	k_syscall_ring_init(&batch_ring, batch_entries, BATCH_OPS);
+
+	direct_start_time = userspace_read_timer_value();
+	for (int i = 0; i < BATCH_OPS; i++) {
+		k_sem_give(&batch_sema);
+	}
+	direct_end_time = userspace_read_timer_value();
+
+	batch_start_time = userspace_read_timer_value();
+	for (int i = 0; i < BATCH_OPS; i++) {
+		(void)k_syscall_ring_push(&batch_ring, K_SYSCALL_K_SEM_GIVE,
+					  (uintptr_t)&batch_sema, 0, 0, 0);
+	}
+	(void)k_syscall_ring_enter(&batch_ring);
+	batch_end_time = userspace_read_timer_value();
+}
+
+void syscall_batch_overhead(void)
+{
+	k_thread_access_grant(k_current_get(), &batch_sema);
+
+	k_thread_create(&my_thread_user, my_stack_area, STACK_SIZE,
+			syscall_batch_user_thread,
+			NULL, NULL, NULL,
+			-1 /*priority*/, K_INHERIT_PERMS | K_USER, K_NO_WAIT);
+
+	/* Per operation, the timer reads are amortized over the batch */
+	u32_t direct_cycles = (u32_t)
+		((SUBTRACT_CLOCK_CYCLES(direct_end_time) -
+		  SUBTRACT_CLOCK_CYCLES(direct_start_time)) &
+		 0xFFFFFFFFULL) / BATCH_OPS;
+
+	u32_t batch_cycles = (u32_t)
+		((SUBTRACT_CLOCK_CYCLES(batch_end_time) -
+		  SUBTRACT_CLOCK_CYCLES(batch_start_time)) &
+		 0xFFFFFFFFULL) / BATCH_OPS;
+
+	PRINT_STATS("Syscall k_sem_give direct, per call",
+		    direct_cycles,
+		    (u32_t) (CYCLES_TO_NS(direct_cycles) & 0xFFFFFFFFULL));
+
+	PRINT_STATS("Syscall k_sem_give batched, per call",
+		    batch_cycles,
+		    (u32_t) (CYCLES_TO_NS(batch_cycles) & 0xFFFFFFFFULL));
+}
+#else
+void syscall_batch_overhead(void)
+{
+}
+#endif /* CONFIG_SYSCALL_BATCH */
@@ -5,6 +5,7 @@
  */
 
 #include <zephyr.h>
+#include <string.h>
 #include <device.h>
 #include <ztest.h>
 #include <sys/printk.h>
@@ -90,6 +91,55 @@ static void test_bogus_dynamic_name(void)
 	zassert_true(mux == NULL, NULL);
 }
 
+#ifdef CONFIG_DEVICE_NAME_INDEX
+extern struct device __device_init_start[];
+extern struct device __device_init_end[];
+
+/**
+ * @brief Test device lookups through the name index
+ *
+ * Every ready device must be found by name, and when names are shared the
+ * first device in link order must be returned, as with the linear search.
+ * Names sorting before, after and in between the indexed ones, as well as
+ * the name of a device whose init failed, must not be found.
+ *
+ * @see device_get_binding()
+ */
+static void test_name_index(void)
+{
+	struct device *info, *first, *dev;
+
+	for (info = __device_init_start; info != __device_init_end; info++) {
+		if (info->driver_api == NULL) {
+			continue;
+		}
+
+		for (first = __device_init_start; first != info; first++) {
+			if ((first->driver_api != NULL) &&
+			    (strcmp(first->config->name,
+				    info->config->name) == 0)) {
+				break;
+			}
+		}
+
+		dev = device_get_binding(info->config->name);
+		zassert_equal(dev, first, "lookup of %s failed",
+			      info->config->name);
+	}
+
+	zassert_is_null(device_get_binding(""), NULL);
+	zassert_is_null(device_get_binding("~~~~"), NULL);
+	zassert_is_null(device_get_binding(DUMMY_PORT_1), NULL);
+	zassert_is_null(device_get_binding(DUMMY_PORT_2 "_"), NULL);
+	zassert_is_null(device_get_binding(BAD_DRIVER), NULL);
+}
+#else
+static void test_name_index(void)
+{
+	ztest_test_skip();
+}
+#endif
+
 #ifdef CONFIG_DEVICE_POWER_MANAGEMENT
 /**
  * @brief Test system device list query API with PM enabled.
@@ -176,6 +226,7 @@ void test_main(void)
 			 ztest_unit_test(test_dummy_device_pm),
 			 ztest_unit_test(build_suspend_device_list),
 			 ztest_unit_test(test_dummy_device),
+			 ztest_unit_test(test_name_index),
 			 ztest_user_unit_test(test_bogus_dynamic_name),
 			 ztest_user_unit_test(test_dynamic_name));
 	ztest_run_test_suite(device);
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+#include <sys/condvar.h>
+#include <sys/mutex.h>
+#include <sys/rwlock.h>
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACKSIZE)
+#define PRIO_OTHER (CONFIG_ZTEST_THREAD_PRIORITY - 1)
+#define WAIT_MS 100
+
+K_THREAD_STACK_DEFINE(other_stack, STACK_SIZE);
+struct k_thread other_tid;
+
+ZTEST_BMEM SYS_RWLOCK_DEFINE(rwlock);
+ZTEST_BMEM SYS_CONDVAR_DEFINE(condvar);
+ZTEST_BMEM SYS_MUTEX_DEFINE(mutex);
+ZTEST_BMEM int other_result;
+ZTEST_BMEM bool other_done;
+ZTEST_BMEM bool ready;
+
+static void other_start(k_thread_entry_t entry)
+{
+	other_done = false;
+	other_result = -1;
+
+	/* The other thread, in user mode, has a higher priority: it runs
+	 * until it waits or is done.
+	 */
+	k_thread_create(&other_tid, other_stack, STACK_SIZE, entry,
+			NULL, NULL, NULL, PRIO_OTHER,
+			K_USER | K_INHERIT_PERMS, K_NO_WAIT);
+}
+
+static void rdlock_entry(void *p1, void *p2, void *p3)
+{
+	other_result = sys_rwlock_rdlock(&rwlock, K_NO_WAIT);
+	if (other_result == 0) {
+		sys_rwlock_unlock(&rwlock);
+	}
+	other_done = true;
+}
+
+static void wrlock_entry(void *p1, void *p2, void *p3)
+{
+	other_result = sys_rwlock_wrlock(&rwlock, K_FOREVER);
+	if (other_result == 0) {
+		sys_rwlock_unlock(&rwlock);
+	}
+	other_done = true;
+}
+
+/**
+ * @brief Test that readers share a sys_rwlock and keep writers out
+ */
+void test_rwlock_readers(void)
+{
+	zassert_equal(sys_rwlock_rdlock(&rwlock, K_NO_WAIT), 0, NULL);
+	zassert_equal(sys_rwlock_rdlock(&rwlock, K_NO_WAIT), 0, NULL);
+	zassert_equal(sys_rwlock_wrlock(&rwlock, K_NO_WAIT), -ETIMEDOUT,
+		      NULL);
+	zassert_equal(sys_rwlock_wrlock(&rwlock, WAIT_MS), -ETIMEDOUT, NULL);
+
+	other_start(rdlock_entry);
+	zassert_true(other_done, NULL);
+	zassert_equal(other_result, 0, "reader kept out by readers");
+
+	other_start(wrlock_entry);
+	zassert_false(other_done, "writer got in along with readers");
+
+	zassert_equal(sys_rwlock_unlock(&rwlock), 0, NULL);
+	zassert_false(other_done, NULL);
+	zassert_equal(sys_rwlock_unlock(&rwlock), 0, NULL);
+
+	/* The last reader woke up the writer */
+	zassert_true(other_done, NULL);
+	zassert_equal(other_result, 0, NULL);
+
+	zassert_equal(sys_rwlock_unlock(&rwlock), -EINVAL, NULL);
+}
+
+/**
+ * @brief Test that a writer holding a sys_rwlock keeps everybody out
+ */
+void test_rwlock_writer(void)
+{
+	zassert_equal(sys_rwlock_wrlock(&rwlock, K_NO_WAIT), 0, NULL);
+	zassert_equal(sys_rwlock_rdlock(&rwlock, WAIT_MS), -ETIMEDOUT, NULL);
+	zassert_equal(sys_rwlock_wrlock(&rwlock, K_NO_WAIT), -ETIMEDOUT,
+		      NULL);
+
+	other_start(rdlock_entry);
+	zassert_equal(other_result, -ETIMEDOUT, NULL);
+
+	other_start(wrlock_entry);
+	zassert_false(other_done, NULL);
+
+	zassert_equal(sys_rwlock_unlock(&rwlock), 0, NULL);
+	zassert_true(other_done, NULL);
+	zassert_equal(other_result, 0, NULL);
+}
+
+static void signal_entry(void *p1, void *p2, void *p3)
+{
+	sys_mutex_lock(&mutex, K_FOREVER);
+	ready = true;
+	other_result = sys_condvar_signal(&condvar);
+	sys_mutex_unlock(&mutex);
+	other_done = true;
+}
+
+/**
+ * @brief Test waiting on a sys_condvar
+ */
+void test_condvar(void)
+{
+	int ret = 0;
+
+	/* Nobody waits, the signal is lost */
+	zassert_equal(sys_condvar_signal(&condvar), 0, NULL);
+	zassert_equal(sys_condvar_broadcast(&condvar), 0, NULL);
+
+	sys_mutex_lock(&mutex, K_FOREVER);
+
+	zassert_equal(sys_condvar_wait(&condvar, &mutex, WAIT_MS),
+		      -ETIMEDOUT, NULL);
+
+	ready = false;
+	other_start(signal_entry);
+
+	/* The other thread waits for the mutex */
+	zassert_false(other_done, NULL);
+
+	while (!ready && ret == 0) {
+		ret = sys_condvar_wait(&condvar, &mutex, K_FOREVER);
+	}
+
+	zassert_equal(ret, 0, NULL);
+	zassert_true(ready, NULL);
+	zassert_equal(other_result, 0, NULL);
+
+	sys_mutex_unlock(&mutex);
+}
+
+static void mutex_entry(void *p1, void *p2, void *p3)
+{
+	other_result = sys_mutex_lock(&mutex, K_FOREVER);
+	if (other_result == 0) {
+		sys_mutex_unlock(&mutex);
+	}
+	other_done = true;
+}
+
+/**
+ * @brief Test contended sys_mutex lock and unlock
+ */
+void test_mutex_contended(void)
+{
+	zassert_equal(sys_mutex_lock(&mutex, K_NO_WAIT), 0, NULL);
+
+	other_start(mutex_entry);
+	zassert_false(other_done, NULL);
+
+	zassert_equal(sys_mutex_unlock(&mutex), 0, NULL);
+	zassert_true(other_done, NULL);
+	zassert_equal(other_result, 0, NULL);
+
+	zassert_equal(sys_mutex_lock(&mutex, K_NO_WAIT), 0, NULL);
+	zassert_equal(sys_mutex_unlock(&mutex), 0, NULL);
+}
+
+void test_main(void)
+{
+	sys_mutex_init(&mutex);
+
+	ztest_test_suite(sys_rwlock,
+			 ztest_1cpu_unit_test(test_rwlock_readers),
+			 ztest_1cpu_unit_test(test_rwlock_writer),
+			 ztest_1cpu_unit_test(test_condvar),
+			 ztest_1cpu_unit_test(test_mutex_contended));
+	ztest_run_test_suite(sys_rwlock);
+}
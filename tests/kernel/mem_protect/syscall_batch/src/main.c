@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+#include <kernel.h>
+
+#define RING_SIZE 4
+
+K_SEM_DEFINE(sem, 0, RING_SIZE);
+
+ZTEST_BMEM struct k_syscall_batch_entry entries[RING_SIZE];
+ZTEST_BMEM struct k_syscall_ring ring;
+ZTEST_BMEM volatile bool expect_fault;
+
+/* Not accessible from user mode */
+static struct k_syscall_batch_entry kernel_entries[RING_SIZE];
+static struct k_syscall_ring kernel_ring;
+
+void k_sys_fatal_error_handler(unsigned int reason, const z_arch_esf_t *esf)
+{
+	printk("Caught system error -- reason %d\n", reason);
+
+	if (expect_fault && reason == K_ERR_KERNEL_OOPS) {
+		expect_fault = false;
+		ztest_test_pass();
+	} else {
+		printk("Unexpected fault during test\n");
+		k_fatal_halt(reason);
+	}
+}
+
+static void ring_reset(void)
+{
+	k_sem_reset(&sem);
+	k_syscall_ring_init(&ring, entries, RING_SIZE);
+}
+
+static struct k_syscall_batch_entry *push_sem_give(void)
+{
+	return k_syscall_ring_push(&ring, K_SYSCALL_K_SEM_GIVE,
+				   (uintptr_t)&sem, 0, 0, 0);
+}
+
+/**
+ * @brief Test that queued calls are executed and their results returned
+ */
+void test_ring_enter(void)
+{
+	struct k_syscall_batch_entry *give, *take;
+
+	ring_reset();
+
+	give = push_sem_give();
+	take = k_syscall_ring_push(&ring, K_SYSCALL_K_SEM_TAKE,
+				   (uintptr_t)&sem, K_NO_WAIT, 0, 0);
+	zassert_not_null(give, NULL);
+	zassert_not_null(take, NULL);
+	give->result = -1;
+	take->result = -1;
+
+	zassert_equal(k_syscall_ring_enter(&ring), 2, NULL);
+	zassert_equal(give->result, 0, NULL);
+	zassert_equal(take->result, 0, NULL);
+	zassert_equal(ring.head, ring.tail, NULL);
+	zassert_equal(k_sem_count_get(&sem), 0, NULL);
+}
+
+/**
+ * @brief Test that a ring outside of the caller's memory faults
+ */
+void test_ring_bad_pointer(void)
+{
+	k_syscall_ring_init(&kernel_ring, kernel_entries, RING_SIZE);
+
+	expect_fault = true;
+	k_syscall_ring_enter(&kernel_ring);
+	zassert_unreachable("ring in kernel memory did not fault");
+}
+
+/**
+ * @brief Test that entries outside of the caller's memory fault
+ */
+void test_ring_bad_entries(void)
+{
+	k_syscall_ring_init(&ring, kernel_entries, RING_SIZE);
+	ring.tail = 1U;
+
+	expect_fault = true;
+	k_syscall_ring_enter(&ring);
+	zassert_unreachable("entries in kernel memory did not fault");
+}
+
+/**
+ * @brief Test that calls which can't be batched stop the batch
+ *
+ * Calls queued before the faulty entry are executed, and the head is left
+ * pointing at it.
+ */
+void test_ring_bad_id(void)
+{
+	ring_reset();
+
+	zassert_not_null(push_sem_give(), NULL);
+	zassert_not_null(k_syscall_ring_push(&ring, K_SYSCALL_K_SLEEP,
+					     0, 0, 0, 0), NULL);
+
+	zassert_equal(k_syscall_ring_enter(&ring), -EINVAL, NULL);
+	zassert_equal(ring.head, 1U, NULL);
+	zassert_equal(k_sem_count_get(&sem), 1, NULL);
+
+	ring_reset();
+
+	zassert_not_null(k_syscall_ring_push(&ring, K_SYSCALL_LIMIT,
+					     0, 0, 0, 0), NULL);
+	zassert_equal(k_syscall_ring_enter(&ring), -EINVAL, NULL);
+	zassert_equal(ring.head, 0U, NULL);
+
+	/* Only K_NO_WAIT timeouts are accepted */
+	ring_reset();
+
+	zassert_not_null(k_syscall_ring_push(&ring, K_SYSCALL_K_SEM_TAKE,
+					     (uintptr_t)&sem, K_FOREVER,
+					     0, 0), NULL);
+	zassert_equal(k_syscall_ring_enter(&ring), -EINVAL, NULL);
+	zassert_equal(ring.head, 0U, NULL);
+}
+
+/**
+ * @brief Test that a full ring takes no more calls and that malformed
+ * rings are rejected
+ */
+void test_ring_overflow(void)
+{
+	int i;
+
+	ring_reset();
+
+	for (i = 0; i < RING_SIZE; i++) {
+		zassert_not_null(push_sem_give(), NULL);
+	}
+	zassert_is_null(push_sem_give(), "push to a full ring succeeded");
+
+	zassert_equal(k_syscall_ring_enter(&ring), RING_SIZE, NULL);
+	zassert_equal(k_sem_count_get(&sem), RING_SIZE, NULL);
+
+	/* More entries pending than the ring holds */
+	ring_reset();
+	ring.tail = RING_SIZE + 1;
+	zassert_equal(k_syscall_ring_enter(&ring), -EINVAL, NULL);
+	zassert_equal(k_sem_count_get(&sem), 0, NULL);
+
+	/* Sizes must be a non-zero power of two */
+	k_syscall_ring_init(&ring, entries, RING_SIZE - 1);
+	zassert_equal(k_syscall_ring_enter(&ring), -EINVAL, NULL);
+
+	k_syscall_ring_init(&ring, entries, 0);
+	zassert_equal(k_syscall_ring_enter(&ring), -EINVAL, NULL);
+}
+
+void test_main(void)
+{
+	k_thread_access_grant(k_current_get(), &sem);
+
+	ztest_test_suite(syscall_batch,
+			 ztest_user_unit_test(test_ring_enter),
+			 ztest_user_unit_test(test_ring_bad_pointer),
+			 ztest_user_unit_test(test_ring_bad_entries),
+			 ztest_user_unit_test(test_ring_bad_id),
+			 ztest_user_unit_test(test_ring_overflow),
+			 ztest_unit_test(test_ring_enter),
+			 ztest_unit_test(test_ring_bad_id));
+	ztest_run_test_suite(syscall_batch);
+}
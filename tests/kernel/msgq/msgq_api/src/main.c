@@ -21,6 +21,9 @@ extern void test_msgq_purge_when_put(void);
 extern void test_msgq_attrs_get(void);
 extern void test_msgq_alloc(void);
 extern void test_msgq_pend_thread(void);
+extern void test_msgq_batch(void);
+extern void test_msgq_batch_pend_thread(void);
+extern void test_msgq_reserve_commit(void);
 #ifdef CONFIG_USERSPACE
 extern void test_msgq_user_thread(void);
 extern void test_msgq_user_thread_overflow(void);
@@ -28,6 +31,7 @@ extern void test_msgq_user_put_fail(void);
 extern void test_msgq_user_get_fail(void);
 extern void test_msgq_user_attrs_get(void);
 extern void test_msgq_user_purge_when_put(void);
+extern void test_msgq_user_batch(void);
 #else
 #define dummy_test(_name) \
 	static void _name(void) \
@@ -41,6 +45,7 @@ dummy_test(test_msgq_user_put_fail);
 dummy_test(test_msgq_user_get_fail);
 dummy_test(test_msgq_user_attrs_get);
 dummy_test(test_msgq_user_purge_when_put);
+dummy_test(test_msgq_user_batch);
 #endif /* CONFIG_USERSPACE */
 
 K_MEM_POOL_DEFINE(test_pool, 128, 128, 2, 4);
@@ -74,6 +79,10 @@ void test_main(void)
 			 ztest_1cpu_unit_test(test_msgq_purge_when_put),
 			 ztest_user_unit_test(test_msgq_user_purge_when_put),
 			 ztest_1cpu_unit_test(test_msgq_pend_thread),
-			 ztest_unit_test(test_msgq_alloc));
+			 ztest_unit_test(test_msgq_alloc),
+			 ztest_1cpu_unit_test(test_msgq_batch),
+			 ztest_user_unit_test(test_msgq_user_batch),
+			 ztest_1cpu_unit_test(test_msgq_batch_pend_thread),
+			 ztest_1cpu_unit_test(test_msgq_reserve_commit));
 	ztest_run_test_suite(msgq_api);
 }
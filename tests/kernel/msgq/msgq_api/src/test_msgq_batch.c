@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "test_msgq.h"
+
+#define BATCH_LEN 5
+
+static ZTEST_BMEM char __aligned(4) bbuffer[MSG_SIZE * BATCH_LEN];
+static ZTEST_BMEM u32_t rx_data[BATCH_LEN * 2];
+static ZTEST_DMEM u32_t tx_data[BATCH_LEN * 2] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9
+};
+extern struct k_msgq msgq;
+extern struct k_thread tdata;
+K_THREAD_STACK_EXTERN(tstack);
+
+static void batch_put_get(struct k_msgq *q)
+{
+	int ret;
+
+	/**TESTPOINT: put_n stops when the queue is full */
+	ret = k_msgq_put_n(q, tx_data, 3, K_NO_WAIT);
+	zassert_equal(ret, 3, NULL);
+	ret = k_msgq_put_n(q, &tx_data[3], 4, K_NO_WAIT);
+	zassert_equal(ret, 2, NULL);
+	ret = k_msgq_put_n(q, tx_data, 1, K_NO_WAIT);
+	zassert_equal(ret, 0, NULL);
+	ret = k_msgq_put_n(q, tx_data, 1, TIMEOUT);
+	zassert_equal(ret, -EAGAIN, NULL);
+
+	/**TESTPOINT: get_n stops when the queue is empty */
+	ret = k_msgq_get_n(q, rx_data, 2, K_NO_WAIT);
+	zassert_equal(ret, 2, NULL);
+	zassert_equal(rx_data[0], 0, NULL);
+	zassert_equal(rx_data[1], 1, NULL);
+
+	/**TESTPOINT: put_n and get_n wrap around the ring buffer */
+	ret = k_msgq_put_n(q, &tx_data[5], 2, K_NO_WAIT);
+	zassert_equal(ret, 2, NULL);
+	ret = k_msgq_get_n(q, rx_data, BATCH_LEN * 2, K_NO_WAIT);
+	zassert_equal(ret, BATCH_LEN, NULL);
+	for (int i = 0; i < BATCH_LEN; i++) {
+		zassert_equal(rx_data[i], i + 2, NULL);
+	}
+
+	ret = k_msgq_get_n(q, rx_data, 1, K_NO_WAIT);
+	zassert_equal(ret, 0, NULL);
+	ret = k_msgq_get_n(q, rx_data, 1, TIMEOUT);
+	zassert_equal(ret, -EAGAIN, NULL);
+}
+
+static void tputter_entry(void *p1, void *p2, void *p3)
+{
+	struct k_msgq *q = p1;
+
+	/* Blocks on the full queue until the main thread makes room */
+	zassert_equal(k_msgq_put_n(q, &tx_data[BATCH_LEN], 2, K_FOREVER), 1,
+		      NULL);
+}
+
+static void tgetter_entry(void *p1, void *p2, void *p3)
+{
+	struct k_msgq *q = p1;
+	u32_t rx;
+
+	zassert_equal(k_msgq_get_n(q, &rx, 1, K_FOREVER), 1, NULL);
+	zassert_equal(rx, 9, NULL);
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Test sending and receiving several messages at once
+ * @see k_msgq_put_n(), k_msgq_get_n()
+ */
+void test_msgq_batch(void)
+{
+	k_msgq_init(&msgq, bbuffer, MSG_SIZE, BATCH_LEN);
+	batch_put_get(&msgq);
+}
+
+#ifdef CONFIG_USERSPACE
+/**
+ * @brief Test sending and receiving several messages at once from user mode
+ * @see k_msgq_alloc_init(), k_msgq_put_n(), k_msgq_get_n()
+ */
+void test_msgq_user_batch(void)
+{
+	struct k_msgq *q;
+
+	q = k_object_alloc(K_OBJ_MSGQ);
+	zassert_not_null(q, "couldn't alloc message queue");
+	zassert_false(k_msgq_alloc_init(q, MSG_SIZE, BATCH_LEN), NULL);
+	batch_put_get(q);
+}
+#endif /* CONFIG_USERSPACE */
+
+/**
+ * @brief Test batches wake up threads pending on the queue
+ * @see k_msgq_put_n(), k_msgq_get_n()
+ */
+void test_msgq_batch_pend_thread(void)
+{
+	k_tid_t tid;
+
+	k_msgq_init(&msgq, bbuffer, MSG_SIZE, BATCH_LEN);
+	zassert_equal(k_msgq_put_n(&msgq, tx_data, BATCH_LEN, K_NO_WAIT),
+		      BATCH_LEN, NULL);
+
+	/**TESTPOINT: get_n queues the message of a pending sender */
+	tid = k_thread_create(&tdata, tstack, STACK_SIZE, tputter_entry,
+			      &msgq, NULL, NULL, K_PRIO_PREEMPT(0), 0,
+			      K_NO_WAIT);
+	k_sleep(K_MSEC(TIMEOUT));
+	zassert_equal(k_msgq_get_n(&msgq, rx_data, 2, K_NO_WAIT), 2, NULL);
+	k_sleep(K_MSEC(TIMEOUT));
+	k_thread_abort(tid);
+	zassert_equal(k_msgq_get_n(&msgq, rx_data, BATCH_LEN, K_NO_WAIT),
+		      BATCH_LEN - 1, NULL);
+	zassert_equal(rx_data[BATCH_LEN - 2], BATCH_LEN, NULL);
+
+	/**TESTPOINT: put_n hands its first message to a pending receiver */
+	tid = k_thread_create(&tdata, tstack, STACK_SIZE, tgetter_entry,
+			      &msgq, NULL, NULL, K_PRIO_PREEMPT(0), 0,
+			      K_NO_WAIT);
+	k_sleep(K_MSEC(TIMEOUT));
+	zassert_equal(k_msgq_put_n(&msgq, &tx_data[9], 1, K_NO_WAIT), 1,
+		      NULL);
+	k_sleep(K_MSEC(TIMEOUT));
+	k_thread_abort(tid);
+	zassert_equal(k_msgq_num_used_get(&msgq), 0, NULL);
+}
+
+/**
+ * @brief Test filling message slots in place
+ * @see k_msgq_put_reserve(), k_msgq_put_commit()
+ */
+void test_msgq_reserve_commit(void)
+{
+	u32_t *slot;
+	u32_t n;
+
+	k_msgq_init(&msgq, bbuffer, MSG_SIZE, BATCH_LEN);
+
+	/* Move the write position so that the free space wraps around */
+	zassert_equal(k_msgq_put_n(&msgq, tx_data, 3, K_NO_WAIT), 3, NULL);
+	zassert_equal(k_msgq_get_n(&msgq, rx_data, 2, K_NO_WAIT), 2, NULL);
+
+	/**TESTPOINT: reservations stop at the end of the ring buffer */
+	n = k_msgq_put_reserve(&msgq, (void **)&slot, BATCH_LEN);
+	zassert_equal(n, 2, NULL);
+	slot[0] = 100U;
+	slot[1] = 101U;
+
+	/**TESTPOINT: reserved slots are not visible before the commit */
+	zassert_equal(k_msgq_num_used_get(&msgq), 1, NULL);
+	k_msgq_put_commit(&msgq, n);
+	zassert_equal(k_msgq_num_used_get(&msgq), 3, NULL);
+
+	n = k_msgq_put_reserve(&msgq, (void **)&slot, BATCH_LEN);
+	zassert_equal(n, 2, NULL);
+	zassert_equal((char *)slot, bbuffer, NULL);
+	slot[0] = 102U;
+	k_msgq_put_commit(&msgq, 1);
+
+	zassert_equal(k_msgq_get_n(&msgq, rx_data, BATCH_LEN, K_NO_WAIT), 4,
+		      NULL);
+	zassert_equal(rx_data[0], 2, NULL);
+	zassert_equal(rx_data[1], 100U, NULL);
+	zassert_equal(rx_data[2], 101U, NULL);
+	zassert_equal(rx_data[3], 102U, NULL);
+
+	/**TESTPOINT: nothing can be reserved in a full queue */
+	zassert_equal(k_msgq_put_n(&msgq, tx_data, BATCH_LEN, K_NO_WAIT),
+		      BATCH_LEN, NULL);
+	zassert_equal(k_msgq_put_reserve(&msgq, (void **)&slot, 1), 0, NULL);
+}
+
+/**
+ * @}
+ */
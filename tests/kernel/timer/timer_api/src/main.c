@@ -34,6 +34,9 @@ static struct k_timer status_timer;
 static struct k_timer status_anytime_timer;
 static struct k_timer status_sync_timer;
 static struct k_timer remain_timer;
+static struct k_timer slack_timer;
+static struct k_timer slack_sync_timer;
+static struct k_timer slack_zero_timer;
 
 static ZTEST_BMEM struct timer_data tdata;
 
@@ -535,6 +538,104 @@ void test_timer_remaining_get(void)
 	zassert_true(remaining <= (DURATION / 2) + k_ticks_to_ms_floor64(1), NULL);
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+#define SLACK 50
+#define SLACK_OFFSET 40
+#define SLACK_ZERO_OFFSET 20
+
+static u32_t slack_expiry[3];
+
+static void slack_expire(struct k_timer *timer)
+{
+	/* The uptime seen by expiry functions is their due tick, not when
+	 * they actually run, so use the cycle counter.
+	 */
+	if (timer == &slack_timer) {
+		slack_expiry[0] = k_cycle_get_32();
+	} else if (timer == &slack_sync_timer) {
+		slack_expiry[1] = k_cycle_get_32();
+	} else {
+		slack_expiry[2] = k_cycle_get_32();
+	}
+}
+
+/**
+ * @brief Test timer slack
+ *
+ * Starts a timer with slack and one without, expiring shortly after the
+ * first one, and checks that the first one expires late but within its
+ * slack. In tickless mode both expire in the same system timer interrupt.
+ *
+ * Then starts them again, followed by a timer without slack expiring
+ * between the two. Although it is not the first timeout, it must expire
+ * on time rather than at the coalesced expiry programmed before it was
+ * added, and the first timer is coalesced with it instead.
+ *
+ * @ingroup kernel_timer_tests
+ *
+ * @see k_timer_slack_set()
+ */
+void test_timer_slack(void)
+{
+	u32_t tick_ms = k_ticks_to_ms_ceil32(1);
+	u32_t tick_cyc = k_ticks_to_cyc_ceil32(1);
+	u32_t start, expiry, sync_expiry, zero_expiry;
+
+	k_timer_slack_set(&slack_timer, SLACK);
+
+	start = k_cycle_get_32();
+	k_timer_start(&slack_timer, DURATION, 0);
+	k_timer_start(&slack_sync_timer, DURATION + SLACK_OFFSET, 0);
+	k_timer_status_sync(&slack_sync_timer);
+	k_timer_status_sync(&slack_timer);
+
+	expiry = k_cyc_to_ms_floor32(slack_expiry[0] - start);
+	sync_expiry = k_cyc_to_ms_floor32(slack_expiry[1] - start);
+
+	/* Expiries are aligned on ticks, allow one tick of error */
+	zassert_true(expiry + tick_ms >= DURATION, NULL);
+	zassert_true(expiry <= DURATION + SLACK + tick_ms, NULL);
+	zassert_true(sync_expiry + tick_ms >= DURATION + SLACK_OFFSET, NULL);
+
+	if (IS_ENABLED(CONFIG_TICKLESS_KERNEL)) {
+		/** TESTPOINT: both timers expire in the same wake-up */
+		zassert_true(slack_expiry[1] - slack_expiry[0] < tick_cyc,
+			     NULL);
+	}
+
+	start = k_cycle_get_32();
+	k_timer_start(&slack_timer, DURATION, 0);
+	k_timer_start(&slack_sync_timer, DURATION + SLACK_OFFSET, 0);
+	k_timer_start(&slack_zero_timer, DURATION + SLACK_ZERO_OFFSET, 0);
+	k_timer_status_sync(&slack_sync_timer);
+	k_timer_status_sync(&slack_zero_timer);
+	k_timer_status_sync(&slack_timer);
+
+	expiry = k_cyc_to_ms_floor32(slack_expiry[0] - start);
+	sync_expiry = k_cyc_to_ms_floor32(slack_expiry[1] - start);
+	zero_expiry = k_cyc_to_ms_floor32(slack_expiry[2] - start);
+
+	/** TESTPOINT: the timer without slack is not delayed */
+	zassert_true(zero_expiry + tick_ms >= DURATION + SLACK_ZERO_OFFSET,
+		     NULL);
+	zassert_true(zero_expiry <= DURATION + SLACK_ZERO_OFFSET + tick_ms,
+		     NULL);
+	zassert_true(expiry <= DURATION + SLACK_ZERO_OFFSET + tick_ms, NULL);
+	zassert_true(sync_expiry + tick_ms >= DURATION + SLACK_OFFSET, NULL);
+
+	if (IS_ENABLED(CONFIG_TICKLESS_KERNEL)) {
+		/** TESTPOINT: the first timer is coalesced with it */
+		zassert_true(slack_expiry[2] - slack_expiry[0] < tick_cyc,
+			     NULL);
+	}
+}
+#else
+void test_timer_slack(void)
+{
+	ztest_test_skip();
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 static void timer_init(struct k_timer *timer, k_timer_expiry_t expiry_fn,
 		       k_timer_stop_t stop_fn)
 {
@@ -553,6 +654,11 @@ void test_main(void)
 	timer_init(&status_anytime_timer, NULL, NULL);
 	timer_init(&status_sync_timer, duration_expire, duration_stop);
 	timer_init(&remain_timer, NULL, NULL);
+#ifdef CONFIG_TIMEOUT_SLACK
+	timer_init(&slack_timer, slack_expire, NULL);
+	timer_init(&slack_sync_timer, slack_expire, NULL);
+	timer_init(&slack_zero_timer, slack_expire, NULL);
+#endif
 
 	k_thread_access_grant(k_current_get(), &ktimer, &timer0, &timer1,
 			      &timer2, &timer3, &timer4);
@@ -568,6 +674,7 @@ void test_main(void)
 			 ztest_user_unit_test(test_timer_status_sync),
 			 ztest_user_unit_test(test_timer_k_define),
 			 ztest_user_unit_test(test_timer_user_data),
-			 ztest_user_unit_test(test_timer_remaining_get));
+			 ztest_user_unit_test(test_timer_remaining_get),
+			 ztest_unit_test(test_timer_slack));
 	ztest_run_test_suite(timer_api);
 }
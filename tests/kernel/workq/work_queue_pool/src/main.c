@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <ztest.h>
+
+#define NUM_THREADS	3
+#define NUM_ITEMS	4
+#define STACK_SIZE	(1024 + CONFIG_TEST_EXTRA_STACKSIZE)
+#define WORK_ITEM_WAIT	100
+#define TEST_KEY	0x1234
+
+K_WORK_Q_POOL_DEFINE(test_pool, NUM_THREADS, STACK_SIZE);
+
+struct test_item {
+	int id;
+	struct k_delayed_work work;
+};
+
+static struct test_item items[NUM_ITEMS];
+
+static int results[NUM_ITEMS];
+static atomic_t num_results;
+static atomic_t num_running;
+static atomic_t max_running;
+
+static void work_handler(struct k_work *work)
+{
+	struct test_item *ti = CONTAINER_OF(work, struct test_item,
+					    work.work);
+	atomic_val_t running = atomic_inc(&num_running) + 1;
+
+	if (running > atomic_get(&max_running)) {
+		atomic_set(&max_running, running);
+	}
+
+	k_sleep(WORK_ITEM_WAIT);
+
+	atomic_dec(&num_running);
+	results[atomic_inc(&num_results)] = ti->id;
+}
+
+static void items_init(u32_t key)
+{
+	int i;
+
+	for (i = 0; i < NUM_ITEMS; i++) {
+		items[i].id = i;
+		k_delayed_work_init(&items[i].work, work_handler);
+		k_work_key_set(&items[i].work.work, key);
+	}
+
+	atomic_clear(&num_results);
+	atomic_clear(&max_running);
+}
+
+/**
+ * @brief Test that work items without a key run concurrently
+ *
+ * @see K_WORK_Q_POOL_DEFINE(), k_work_q_pool_start()
+ */
+static void test_pool_concurrent(void)
+{
+	int i;
+
+	items_init(0);
+
+	for (i = 0; i < NUM_THREADS; i++) {
+		k_work_submit_to_queue(&test_pool.work_q, &items[i].work.work);
+	}
+
+	/* A single thread would need NUM_THREADS times as long */
+	k_sleep(WORK_ITEM_WAIT + WORK_ITEM_WAIT / 2);
+
+	zassert_equal(atomic_get(&num_results), NUM_THREADS,
+		      "work items did not run concurrently");
+	zassert_equal(atomic_get(&max_running), NUM_THREADS, NULL);
+}
+
+/**
+ * @brief Test that work items sharing a key run one at a time, in order
+ *
+ * @see k_work_key_set()
+ */
+static void test_pool_key(void)
+{
+	int i;
+
+	items_init(TEST_KEY);
+
+	for (i = 0; i < NUM_ITEMS; i++) {
+		k_work_submit_to_queue(&test_pool.work_q, &items[i].work.work);
+	}
+
+	k_sleep((NUM_ITEMS + 1) * WORK_ITEM_WAIT);
+
+	zassert_equal(atomic_get(&num_results), NUM_ITEMS, NULL);
+	zassert_equal(atomic_get(&max_running), 1,
+		      "work items with the same key ran concurrently");
+
+	for (i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(results[i], i, "work items ran out of order");
+	}
+}
+
+/**
+ * @brief Test delayed work items on a workqueue pool
+ *
+ * @see k_delayed_work_submit_to_queue()
+ */
+static void test_pool_delayed(void)
+{
+	items_init(0);
+
+	k_delayed_work_submit_to_queue(&test_pool.work_q, &items[0].work,
+				       WORK_ITEM_WAIT);
+	k_delayed_work_submit_to_queue(&test_pool.work_q, &items[1].work,
+				       WORK_ITEM_WAIT);
+	zassert_equal(k_delayed_work_cancel(&items[1].work), 0, NULL);
+
+	k_sleep(WORK_ITEM_WAIT / 2);
+	zassert_equal(atomic_get(&num_results), 0, NULL);
+
+	k_sleep(2 * WORK_ITEM_WAIT);
+	zassert_equal(atomic_get(&num_results), 1, NULL);
+	zassert_equal(results[0], 0, NULL);
+}
+
+/**
+ * @brief Test the statistics of a workqueue pool
+ *
+ * @see k_work_q_pool_stats_get()
+ */
+static void test_pool_stats(void)
+{
+	struct k_work_q_pool_stats stats;
+
+	k_work_q_pool_stats_get(&test_pool, &stats);
+
+	zassert_equal(stats.depth, 0, NULL);
+	zassert_equal(stats.processed, NUM_THREADS + NUM_ITEMS + 1, NULL);
+
+	/* Items of the same key waited for the previous ones */
+	zassert_true(stats.latency_max >= USEC_PER_MSEC * WORK_ITEM_WAIT,
+		     NULL);
+	zassert_true(stats.latency_avg <= stats.latency_max, NULL);
+}
+
+void test_main(void)
+{
+	k_work_q_pool_start(&test_pool, K_PRIO_PREEMPT(1));
+
+	ztest_test_suite(workqueue_pool,
+			 ztest_unit_test(test_pool_concurrent),
+			 ztest_unit_test(test_pool_key),
+			 ztest_unit_test(test_pool_delayed),
+			 ztest_unit_test(test_pool_stats)
+			 );
+	ztest_run_test_suite(workqueue_pool);
+}
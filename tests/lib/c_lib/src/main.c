@@ -293,6 +293,85 @@ void test_memcmp(void)
 	zassert_true((ret != 0), "memcmp 5");
 }
 
+/**
+ *
+ * @brief Test memory functions on all buffer alignments
+ *
+ */
+
+#define ALIGN_MAX 8
+#define ALIGN_LEN 40
+
+void test_mem_alignment(void)
+{
+	unsigned char src[ALIGN_LEN + ALIGN_MAX];
+	unsigned char dst[ALIGN_LEN + 2 * ALIGN_MAX];
+	unsigned char *s, *d;
+	size_t so, d_off, n, i;
+	int c;
+
+	for (i = 0; i < sizeof(src); i++) {
+		src[i] = i + 1;
+	}
+
+	for (so = 0; so < ALIGN_MAX; so++) {
+		for (d_off = 0; d_off < ALIGN_MAX; d_off++) {
+			for (n = 0; n <= ALIGN_LEN; n++) {
+				s = src + so;
+				d = dst + d_off;
+				(void)memset(dst, 0, sizeof(dst));
+
+				zassert_equal(memcpy(d, s, n), d, "memcpy ret");
+				for (i = 0; i < sizeof(dst); i++) {
+					zassert_equal(dst[i],
+						      (i >= d_off &&
+						       i < d_off + n) ?
+						      s[i - d_off] : 0,
+						      "memcpy");
+				}
+
+				zassert_equal(memcmp(d, s, n), 0, "memcmp eq");
+				if (n > 0) {
+					d[n - 1] = 0xff;
+					zassert_true(memcmp(d, s, n) > 0,
+						     "memcmp unsigned");
+					zassert_true(memcmp(s, d, n) < 0,
+						     "memcmp unsigned");
+				}
+
+				/* every byte value of src is unique, and
+				 * none is 0
+				 */
+				c = (n > 0) ? s[n - 1] : 0;
+				zassert_equal(memchr(s, c, n),
+					      (n > 0) ? &s[n - 1] : NULL,
+					      "memchr");
+			}
+		}
+	}
+}
+
+void test_str_alignment(void)
+{
+	char str[ALIGN_LEN + ALIGN_MAX + 1];
+	size_t off, n;
+
+	for (off = 0; off < ALIGN_MAX; off++) {
+		for (n = 0; n <= ALIGN_LEN; n++) {
+			(void)memset(str, 'a', sizeof(str));
+			str[off + n] = '\0';
+
+			zassert_equal(strlen(str + off), n, "strlen");
+			zassert_equal(strnlen(str + off, n / 2), n / 2,
+				      "strnlen short");
+			zassert_equal(strnlen(str + off, n + 1), n,
+				      "strnlen");
+			zassert_equal(memchr(str + off, '\0', n + 1),
+				      str + off + n, "memchr nul");
+		}
+	}
+}
+
 /**
  *
  * @brief Test binary search function
@@ -328,6 +407,8 @@ void test_main(void)
 			 ztest_unit_test(test_stddef),
 			 ztest_unit_test(test_stdint),
 			 ztest_unit_test(test_memcmp),
+			 ztest_unit_test(test_mem_alignment),
+			 ztest_unit_test(test_str_alignment),
 			 ztest_unit_test(test_strchr),
 			 ztest_unit_test(test_strcpy),
 			 ztest_unit_test(test_strncpy),
@@ -443,6 +443,153 @@ void test_reset(void)
 	zassert_true(granted == RINGBUFFER_SIZE - 1, NULL);
 }
 
+RING_BUF_LF_DECLARE_POW2(ringbuf_lf, 4);
+
+void test_lf_put_get(void)
+{
+	u8_t indata[12] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+	u8_t outdata[16];
+	u32_t len;
+
+	zassert_true(ring_buf_lf_is_empty(&ringbuf_lf), NULL);
+	zassert_equal(ring_buf_lf_space_get(&ringbuf_lf), 16, NULL);
+
+	/* Unlike ring_buf, the whole buffer can be filled */
+	for (int i = 0; i < 10; i++) {
+		len = ring_buf_lf_put(&ringbuf_lf, indata, sizeof(indata));
+		zassert_equal(len, sizeof(indata), NULL);
+		len = ring_buf_lf_put(&ringbuf_lf, indata, sizeof(indata));
+		zassert_equal(len, 16 - sizeof(indata), NULL);
+		zassert_equal(ring_buf_lf_space_get(&ringbuf_lf), 0, NULL);
+
+		len = ring_buf_lf_get(&ringbuf_lf, outdata, sizeof(outdata));
+		zassert_equal(len, 16, NULL);
+		zassert_true(memcmp(outdata, indata, sizeof(indata)) == 0,
+			     NULL);
+		zassert_true(memcmp(&outdata[sizeof(indata)], indata,
+				    16 - sizeof(indata)) == 0, NULL);
+		zassert_true(ring_buf_lf_is_empty(&ringbuf_lf), NULL);
+
+		/* Move the indexes so that the next round wraps */
+		len = ring_buf_lf_put(&ringbuf_lf, indata, 3);
+		zassert_equal(ring_buf_lf_get(&ringbuf_lf, outdata, 3), 3,
+			      NULL);
+	}
+}
+
+void test_lf_claim_finish(void)
+{
+	u32_t granted;
+	u8_t *data;
+	int err;
+
+	ring_buf_lf_init(&ringbuf_lf, 16, ringbuf_lf.buf);
+
+	granted = ring_buf_lf_put_claim(&ringbuf_lf, &data, 10);
+	zassert_equal(granted, 10, NULL);
+	memset(data, 0xaa, granted);
+
+	/* Claimed bytes are not visible before they are finished */
+	granted = ring_buf_lf_get_claim(&ringbuf_lf, &data, 16);
+	zassert_equal(granted, 0, NULL);
+
+	/* Finishing more than claimed fails, finishing less releases */
+	err = ring_buf_lf_put_finish(&ringbuf_lf, 11);
+	zassert_true(err != 0, NULL);
+	err = ring_buf_lf_put_finish(&ringbuf_lf, 8);
+	zassert_true(err == 0, NULL);
+	zassert_equal(ring_buf_lf_space_get(&ringbuf_lf), 8, NULL);
+
+	granted = ring_buf_lf_get_claim(&ringbuf_lf, &data, 16);
+	zassert_equal(granted, 8, NULL);
+	zassert_equal(data[7], 0xaa, NULL);
+	err = ring_buf_lf_get_finish(&ringbuf_lf, 9);
+	zassert_true(err != 0, NULL);
+	err = ring_buf_lf_get_finish(&ringbuf_lf, 8);
+	zassert_true(err == 0, NULL);
+
+	/* Claims stop at the end of the buffer */
+	granted = ring_buf_lf_put_claim(&ringbuf_lf, &data, 16);
+	zassert_equal(granted, 8, NULL);
+	granted = ring_buf_lf_put_claim(&ringbuf_lf, &data, 16);
+	zassert_equal(granted, 8, NULL);
+	zassert_equal(data, ringbuf_lf.buf, NULL);
+	err = ring_buf_lf_put_finish(&ringbuf_lf, 16);
+	zassert_true(err == 0, NULL);
+}
+
+static void tringbuf_lf_mp_put(void *p)
+{
+	u8_t indata[6];
+
+	memset(indata, POINTER_TO_UINT(p), sizeof(indata));
+	zassert_equal(ring_buf_lf_mp_put(&ringbuf_lf, indata, sizeof(indata)),
+		      sizeof(indata), NULL);
+}
+
+void test_lf_mp_put(void)
+{
+	u8_t outdata[16];
+	u32_t granted;
+	u8_t *data;
+
+	ring_buf_lf_init(&ringbuf_lf, 16, ringbuf_lf.buf);
+
+	/* A write interrupted by another producer is published with it */
+	granted = ring_buf_lf_mp_put_claim(&ringbuf_lf, &data, 4);
+	zassert_equal(granted, 4, NULL);
+	memset(data, 1, granted);
+	irq_offload(tringbuf_lf_mp_put, UINT_TO_POINTER(2));
+	zassert_true(ring_buf_lf_is_empty(&ringbuf_lf), NULL);
+	ring_buf_lf_mp_put_finish(&ringbuf_lf);
+
+	zassert_equal(ring_buf_lf_get(&ringbuf_lf, outdata, sizeof(outdata)),
+		      10, NULL);
+	zassert_equal(outdata[3], 1, NULL);
+	zassert_equal(outdata[4], 2, NULL);
+	zassert_equal(outdata[9], 2, NULL);
+
+	/* Copies are all or nothing and wrap around */
+	zassert_equal(ring_buf_lf_mp_put(&ringbuf_lf, outdata, 17), 0, NULL);
+	zassert_equal(ring_buf_lf_mp_put(&ringbuf_lf, outdata, 16), 16, NULL);
+	zassert_equal(ring_buf_lf_mp_put(&ringbuf_lf, outdata, 1), 0, NULL);
+	zassert_equal(ring_buf_lf_get(&ringbuf_lf, outdata, sizeof(outdata)),
+		      16, NULL);
+	zassert_equal(outdata[4], 2, NULL);
+}
+
+void test_lf_mp_put_finish_order(void)
+{
+	u8_t outdata[16];
+	u32_t granted;
+	u8_t *data_a, *data_b;
+
+	ring_buf_lf_init(&ringbuf_lf, 16, ringbuf_lf.buf);
+
+	/* A finishes last, after B claimed, wrote and finished behind it */
+	granted = ring_buf_lf_mp_put_claim(&ringbuf_lf, &data_a, 5);
+	zassert_equal(granted, 5, NULL);
+	memset(data_a, 1, granted);
+
+	granted = ring_buf_lf_mp_put_claim(&ringbuf_lf, &data_b, 5);
+	zassert_equal(granted, 5, NULL);
+	memset(data_b, 2, granted);
+	ring_buf_lf_mp_put_finish(&ringbuf_lf);
+
+	/* B is not visible while A is still writing in front of it */
+	zassert_true(ring_buf_lf_is_empty(&ringbuf_lf), NULL);
+
+	ring_buf_lf_mp_put_finish(&ringbuf_lf);
+
+	/* A publishes B's bytes along with its own */
+	zassert_equal(ring_buf_lf_get(&ringbuf_lf, outdata, sizeof(outdata)),
+		      10, NULL);
+	zassert_equal(outdata[4], 1, NULL);
+	zassert_equal(outdata[5], 2, NULL);
+	zassert_equal(outdata[9], 2, NULL);
+	zassert_true(ring_buf_lf_is_empty(&ringbuf_lf), NULL);
+}
+
 /*test case main entry*/
 void test_main(void)
 {
@@ -461,7 +608,11 @@ void test_main(void)
 			 ztest_unit_test(test_byte_put_free),
 			 ztest_unit_test(test_byte_put_free),
 			 ztest_unit_test(test_capacity),
-			 ztest_unit_test(test_reset)
+			 ztest_unit_test(test_reset),
+			 ztest_unit_test(test_lf_put_get),
+			 ztest_unit_test(test_lf_claim_finish),
+			 ztest_unit_test(test_lf_mp_put),
+			 ztest_unit_test(test_lf_mp_put_finish_order)
 			 );
 	ztest_run_test_suite(test_ringbuffer_api);
 }
@@ -51,9 +51,59 @@ void test_collecting(void)
 	}
 }
 
+void test_hash(void)
+{
+#ifdef CONFIG_IMG_STREAM_HASH
+	struct tc_sha256_state_struct sha256;
+	u8_t expected[TC_SHA256_DIGEST_SIZE];
+	u8_t digest[TC_SHA256_DIGEST_SIZE];
+	struct flash_img_context ctx;
+	u8_t data[37];
+	u32_t i, j;
+	int ret;
+
+	ret = flash_img_init(&ctx);
+	zassert_true(ret == 0, "Flash img init");
+
+	ret = flash_area_erase(ctx.flash_area, 0, ctx.flash_area->fa_size);
+	zassert_true(ret == 0, "Flash erase");
+
+	tc_sha256_init(&sha256);
+
+	for (i = 0U; i < 100; i++) {
+		for (j = 0U; j < ARRAY_SIZE(data); j++) {
+			data[j] = i * j;
+		}
+		tc_sha256_update(&sha256, data, sizeof(data));
+		zassert_true(flash_img_buffered_write(&ctx, data, sizeof(data),
+						      false) == 0, "Write");
+	}
+
+	zassert_equal(flash_img_hash_get(&ctx, digest), -EBUSY,
+		      "Digest available before flush");
+
+	zassert_true(flash_img_buffered_write(&ctx, data, 0, true) == 0,
+		     "Flush");
+	tc_sha256_final(expected, &sha256);
+
+	zassert_equal(flash_img_hash_get(&ctx, digest), 0, "Digest get");
+	zassert_mem_equal(digest, expected, sizeof(digest), "Wrong digest");
+
+	/* The digest of the previous image is gone once started again */
+	ret = flash_img_init(&ctx);
+	zassert_true(ret == 0, "Flash img init");
+	zassert_equal(flash_img_hash_get(&ctx, digest), -EBUSY,
+		      "Stale digest available");
+	flash_area_close(ctx.flash_area);
+#else
+	ztest_test_skip();
+#endif
+}
+
 void test_main(void)
 {
 	ztest_test_suite(test_util,
-			ztest_unit_test(test_collecting));
+			ztest_unit_test(test_collecting),
+			ztest_unit_test(test_hash));
 	ztest_run_test_suite(test_util);
 }
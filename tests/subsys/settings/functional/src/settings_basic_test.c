@@ -613,6 +613,82 @@ static void test_direct_loading_filter(void)
 	}
 }
 
+static void test_load_one(void)
+{
+	const struct test_loading_data *ldata;
+	const char *prefix = filtered_loader_settings.name;
+	char buffer[48];
+	char value[32];
+	ssize_t rc;
+
+	/* Relies on the data stored by test_direct_loading_filter */
+	for (ldata = data_final; ldata->n; ++ldata) {
+		strcpy(buffer, prefix);
+		strcat(buffer, "/");
+		strcat(buffer, ldata->n);
+
+		rc = settings_load_one(buffer, value, sizeof(value));
+		zassert_equal(strlen(ldata->v) + 1, rc, "%s", buffer);
+		zassert_false(strcmp(ldata->v, value), "e: \"%s\", a:\"%s\"",
+			      ldata->v, value);
+	}
+
+	/* Deleted item */
+	strcpy(buffer, prefix);
+	strcat(buffer, "/to_delete");
+	rc = settings_load_one(buffer, value, sizeof(value));
+	zassert_equal(-ENOENT, rc, NULL);
+
+	/* Only items below, nothing stored under the name itself */
+	strcpy(buffer, prefix);
+	strcat(buffer, "/val");
+	rc = settings_load_one(buffer, value, sizeof(value));
+	zassert_equal(-ENOENT, rc, NULL);
+}
+
+#if defined(CONFIG_SETTINGS_WRITE_CACHE)
+static void test_write_cache(void)
+{
+	struct settings_write_cache_stats before, after;
+	u32_t val;
+	ssize_t rc;
+
+	settings_write_cache_stats_get(&before);
+
+	for (val = 1U; val <= 3U; val++) {
+		rc = settings_save_one("wc/val", &val, sizeof(val));
+		zassert_equal(0, rc, "can't save the value");
+	}
+
+	/* Nothing written yet, the second and third save replaced the first */
+	settings_write_cache_stats_get(&after);
+	zassert_equal(3, after.saves - before.saves, NULL);
+	zassert_equal(0, after.writes - before.writes, NULL);
+	zassert_equal(2, after.avoided - before.avoided, NULL);
+
+	/* Loading flushes the cache first */
+	val = 0U;
+	rc = settings_load_one("wc/val", &val, sizeof(val));
+	zassert_equal(sizeof(val), rc, NULL);
+	zassert_equal(3U, val, NULL);
+
+	settings_write_cache_stats_get(&after);
+	zassert_equal(1, after.writes - before.writes, NULL);
+
+	rc = settings_delete("wc/val");
+	zassert_equal(0, rc, "can't delete the value");
+	rc = settings_flush();
+	zassert_equal(0, rc, "can't flush the cache");
+
+	rc = settings_load_one("wc/val", &val, sizeof(val));
+	zassert_equal(-ENOENT, rc, NULL);
+}
+#else
+static void test_write_cache(void)
+{
+	ztest_test_skip();
+}
+#endif /* CONFIG_SETTINGS_WRITE_CACHE */
 
 void test_main(void)
 {
@@ -621,7 +697,9 @@ void test_main(void)
 			 ztest_unit_test(test_support_rtn),
 			 ztest_unit_test(test_register_and_loading),
 			 ztest_unit_test(test_direct_loading),
-			 ztest_unit_test(test_direct_loading_filter)
+			 ztest_unit_test(test_direct_loading_filter),
+			 ztest_unit_test(test_load_one),
+			 ztest_unit_test(test_write_cache)
 			);
 
 	ztest_run_test_suite(settings_test_suite);